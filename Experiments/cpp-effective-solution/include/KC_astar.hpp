@@ -1,11 +1,14 @@
 #pragma once
 
 #include <fstream>
+#include <chrono>
+#include <atomic>
 #include <KC_searching.hpp>
 #include <KC_structs.hpp>
 #include <KC_search_params.hpp>
+#include <KC_simd.hpp>
 
-extern MyHEAP* HEAP;
+extern thread_local MyHEAP* HEAP;
 
 
 
@@ -16,9 +19,14 @@ struct ResultSearch {
     */
 
     bool find_path;  // найден ли путь
+    bool out_of_time;  // поиск остановлен ограничением (время, шаги, память или отмена - см. stopped), путь при этом не найден
+    int stopped;  // какое именно ограничение остановило поиск (SearchStop)
     int steps;  // количество шагов, затраченных алгоритмом
     ptrSearchNode final_node;  // финальная вершина в поиске (если путь нашелся, то она совпадает с последней вершиной пути -> 
                                // -> от нее путь можно восстановить) 
+    ptrSearchNode best_node;  // если поиск остановлен ограничением - раскрытая вершина с наименьшей эвристикой (ближе всех к цели):
+                              // от неё восстанавливается частичный путь; она лежит в CLOSED, поэтому удаляется вместе с деревом
+    SearchStats stats;  // подробная статистика поиска (заполнена, только если объявлен SEARCH_STATS в common.hpp)
     
     ResultSearch(bool find_path, int steps, ptrSearchNode final_node) {
         /*
@@ -28,6 +36,9 @@ struct ResultSearch {
         this->find_path = find_path;
         this->steps = steps;
         this->final_node = final_node;
+        out_of_time = 0;
+        stopped = 0;
+        best_node = NULL_Node;
     }
 
 
@@ -47,6 +58,117 @@ struct ResultSearch {
 
 
 
+enum SearchStop {STOP_NONE = 0, STOP_TIME, STOP_EXPANSIONS, STOP_MEMORY, STOP_CANCEL};  // причины остановки поиска
+
+
+struct SearchLimits {
+    /*
+    Данная структура описывает ограничения поиска (0 или NULL - без ограничения):
+        time_budget - время в секундах с момента создания ограничений (крайний срок общий для всего, что ищется с ними);
+        max_expansions - количество шагов (раскрытий вершин);
+        max_memory - сколько байт памяти кучи HEAP поиск может занять сверх уже занятого в момент создания (память
+            самого дерева поиска - битовый CLOSED, массивы OPEN - сюда не входит);
+        cancel - внешний флаг отмены: поиск останавливается, как только его выставят (например, из другого потока).
+    Количество шагов проверяется на каждом шаге, а часы, флаг и память - только раз в check_period шагов (степень
+    двойки), чтобы проверка почти ничего не стоила.
+    */
+
+    double time_budget;
+    long long max_expansions;
+    size_t max_memory;
+    const atomic <bool> *cancel;
+    int check_period;
+
+    explicit SearchLimits(double time_budget = 0, long long max_expansions = 0, size_t max_memory = 0,
+                          const atomic <bool> *cancel = NULL) {
+        this->time_budget = time_budget;
+        this->max_expansions = max_expansions;
+        this->max_memory = max_memory;
+        this->cancel = cancel;
+        check_period = 256;
+        until = chrono::steady_clock::now() + chrono::duration_cast <chrono::steady_clock::duration> (chrono::duration <double> (time_budget));
+        memory_at_start = (max_memory > 0) ? HEAP->used_bytes() : 0;
+    }
+
+    bool limited() const {
+        /*
+        Задано ли хоть одно ограничение (иначе поиск не может быть остановлен, и частичный результат не нужен).
+        */
+
+        return time_budget > 0 || max_expansions > 0 || max_memory > 0 || cancel != NULL;
+    }
+
+    SearchStop passed(long long step) {
+        /*
+        Возвращает причину, по которой поиск нужно остановить на шаге step (STOP_NONE = 0, если продолжать).
+        */
+
+        if (max_expansions > 0 && step > max_expansions)
+            return STOP_EXPANSIONS;
+        if ((step & (check_period - 1)) != 0)
+            return STOP_NONE;
+        if (cancel != NULL && cancel->load(memory_order_relaxed))
+            return STOP_CANCEL;
+        if (time_budget > 0 && chrono::steady_clock::now() >= until)
+            return STOP_TIME;
+        if (max_memory > 0 && HEAP->used_bytes() > memory_at_start + max_memory)
+            return STOP_MEMORY;
+        return STOP_NONE;
+    }
+
+private:
+    chrono::steady_clock::time_point until;
+    size_t memory_at_start;
+};
+
+
+struct BestByHeuristic {
+    /*
+    Данная структура запоминает раскрытую вершину с наименьшей эвристикой - её возвращает поиск, остановленный
+    ограничением (частичный результат). Такую вершину нельзя удалять при помещении в CLOSED (на графе типов там
+    удаляются нецелевые ячейки), поэтому ей выставляется mem_after_closed = 1 - она удалится вместе с деревом.
+    Если поиск остановить нельзя (enabled = 0 - ограничения не заданы), то ничего не запоминается: тогда раскрытие не
+    тратит время на учёт, а нецелевые ячейки удаляются из CLOSED, как обычно.
+    */
+
+    ptrSearchNode node;
+    long double h;
+    bool enabled;
+
+    explicit BestByHeuristic(bool enabled = true) {
+        node = NULL_Node;
+        h = 0;
+        this->enabled = enabled;
+    }
+
+    void update(ptrSearchNode current) {
+        if (!enabled)
+            return;
+        long double current_h = current->f - current->g;
+        if (node == NULL_Node || current_h < h) {
+            node = current;
+            h = current_h;
+            current->mem_after_closed = 1;
+        }
+    }
+};
+
+
+static inline ResultSearch stopped_result(int steps, SearchStop stop, ptrSearchNode best_node) {
+    /*
+    Результат поиска, остановленного ограничением stop (best_node - частичный результат, см. BestByHeuristic).
+    */
+
+    ResultSearch res(0, steps, NULL_Node);
+    res.out_of_time = 1;
+    res.stopped = stop;
+    res.best_node = best_node;
+    return res;
+}
+
+
+
+
 template <typename T>
 static inline void add_start_node_to_open(T *p) {
     /*
@@ -70,12 +192,12 @@ static inline void set_parent(void *p, ptrSearchNode current, ptrSearchNode new_
     производить просто отщипывая по примитиву с конца пути, а примитив идёт из одной целевой
     ячейки (так как он там начался <=> какой-то там закончился) в другую целевую (она целевая,
     так как он в ней кончился) -> в качестве родителя типовой ячейки стоит хранить предыдущую
-    целевую ячейку на пути (а восстановление пути (траектории) будет реализуемо, например, так: сначала выписать
-    цепочку целевых ячеек на пути (пользуясь как раз этими родителями в вершинах), а потом, хоть
-    перебором подобрать примитивы между этими целевыми ячейками, чтобы они стыковались друг с другом
-    и не пересекали с препятствиями... это чуть сложнее, чем то, как делали в коде на Питоне, но зато
-    позволяет в списке CLOSED запоминать только целевые ячейки, а все остальные удалять - так как ими
-    всё равно пользоваться не будем).
+    целевую ячейку на пути (а восстановление пути (траектории) делается так: сначала выписывается
+    цепочка целевых ячеек на пути (пользуясь как раз этими родителями в вершинах), а потом по индексу
+    примитивов подбираются примитивы между этими целевыми ячейками, чтобы они стыковались друг с другом
+    и не пересекались с препятствиями - см. reconstruct_trajectory в KC_trajectory.hpp... это чуть сложнее, чем
+    то, как делали в коде на Питоне, но зато позволяет в списке CLOSED запоминать только целевые ячейки, а все
+    остальные удалять - так как ими всё равно пользоваться не будем).
     */
 
     if (current->vertex->type == -1) {  // если тип вершины = -1, то это дискретное состояние -> поиск на state lattice->
@@ -94,11 +216,99 @@ static inline void set_parent(void *p, ptrSearchNode current, ptrSearchNode new_
 
 
 template <typename T>
-static inline ptrSearchNode StepAstar(T *p, vector <pair <ptrVertex, long double>> &succ_list) {
+static inline void generate_successors(T *p, ptrSearchNode current, Successors &succ_list) {
+    /*
+    Данная функция складывает в succ_list соседей вершины поиска current (первая половина её раскрытия). Вершины
+    графа для них пока не создаются - только ключи (см. Successors).
+    */
+
+    succ_list.reserve(p->max_degree);  // (память выделяется только при первом вызове)
+    succ_list.clear();  // очищаем список соседей
+    p->get_successors(current->vertex, succ_list);  // теперь наполняем соседями вершину current
+    STATS(p->ast->stats.expanded += 1;
+          p->ast->stats.generated += succ_list.size);
+}
+
+
+template <typename T>
+struct BatchHeuristic {
+    /*
+    Эвристика настроек поиска p: либо одной вершины u (p->heuristic), либо сразу для n клеток (i[k], j[k]) - в h[k]
+    (p->heuristic_batch, см. KC_simd.hpp). Оба вида должна уметь считать любая эвристика, с которой раскрываются
+    вершины (например, минимум эвристик до нескольких целей в AstarSearchMany): пакетом последователи считаются только
+    с SIMD_HEURISTIC, а без него - по одной вершине, как и стартовая вершина.
+    */
+
+    T *p;
+    long double operator()(ptrVertex u) const { return p->heuristic(u); }
+    void operator()(const int *i, const int *j, int n, long double *h) const { p->heuristic_batch(i, j, n, h); }
+};
+
+
+template <typename T, typename H>
+static inline ptrSearchNode insert_successors(T *p, ptrSearchNode current, Successors &succ_list, H heuristic,
+                                              bool goal_test = false) {
+    /*
+    Данная функция добавляет в OPEN всех ещё не раскрытых соседей succ_list вершины поиска current (f-значение
+    считается с эвристикой heuristic) - вторая половина её раскрытия. CLOSED проверяется по ключу соседа, и вершина
+    графа в куче создаётся только для тех соседей, которые попадают в OPEN.
+    Если goal_test = 1, то цель проверяется уже здесь (p->is_goal_key): среди целевых соседей самый близкий по g в
+    OPEN не попадает, а возвращается (как вершина, извлечённая из OPEN в AstarSearch, - её нужно удалить отдельно).
+    Так поиск заканчивается на один слой раскрытий раньше, но найденный путь может оказаться немного дороже: в OPEN
+    могла остаться вершина с меньшим f, через которую цель достижима дешевле. Если целевых соседей нет (или goal_test
+    = 0), возвращается NULL_Node.
+    */
+
+#ifdef SIMD_HEURISTIC
+    static thread_local SuccessorBatch batch;  // (эвристики считаются заранее для всех соседей сразу)
+    batch.gather(succ_list);
+    heuristic(batch.i.data(), batch.j.data(), succ_list.size, batch.h.data());
+#endif
+
+    ptrSearchNode goal = NULL_Node;
+    for (int k = 0; k < succ_list.size; k ++) {  // пересчитываем расстояния до соседей u у вершины v
+        StateKey key = succ_list.key[k];
+        if (p->ast->was_expanded(state_i(key), state_j(key), succ_list.info[k]) == 0) {
+            ptrSearchNode new_node = HEAP->new_SearchNode(p->new_vertex(key, succ_list.info[k]));
+            new_node->g = current->g + succ_list.cost[k];  // новое расстояние до соседа
+#ifdef SIMD_HEURISTIC
+            new_node->f = new_node->g + batch.h[k];
+#else
+            new_node->f = new_node->g + heuristic(new_node->vertex);  // (по одной вершине: см. BatchHeuristic)
+#endif
+            set_parent(p, current, new_node);
+            if (goal_test && p->is_goal_key(succ_list.key[k]) && (goal == NULL_Node || new_node->g < goal->g))
+                swap(goal, new_node);  // (прежний лучший целевой сосед, если он был, уходит в OPEN как обычно)
+            if (!(new_node == NULL_Node))
+                p->ast->add_to_open(new_node);
+        } else {
+            STATS(p->ast->stats.pruned_closed += 1);  // если вершина уже раскрыта - просто пропускаем её
+        }
+    }
+    return goal;
+}
+
+
+template <typename T, typename H>
+static inline void expand_node(T *p, ptrSearchNode current, Successors &succ_list, H heuristic) {
+    /*
+    Данная функция раскрывает вершину поиска current: добавляет в OPEN всех её ещё не раскрытых соседей (f-значение
+    считается с эвристикой heuristic). В CLOSED саму current не помещает.
+    */
+
+    generate_successors(p, current, succ_list);
+    insert_successors(p, current, succ_list, heuristic);
+}
+
+
+template <typename T>
+static inline ptrSearchNode StepAstar(T *p, Successors &succ_list, BestByHeuristic &best) {
     /*
     Данная функция производит одну итерацию поиска алгоритмом A*:
         извлечение вершины из OPEN, её раскрытие, перемещение её в CLOSED.
     Возвращаемое значение такое: v - SearchNode, если поиск нашел путь и NULL_Node в остальных случаях.
+    Раскрытая вершина учитывается в best (частичный результат на случай остановки поиска).
+    Если у настроек выставлен goal_at_generation, то путь может найтись и среди последователей раскрытой вершины.
     */
 
     ptrSearchNode current = p->ast->get_best_node_from_open();  // извлекаем SearchNode с минимальным f-значением 
@@ -109,83 +319,325 @@ static inline ptrSearchNode StepAstar(T *p, vector <pair <ptrVertex, long double
     if (p->is_goal(v))  // дошли до целевой -> путь найден
         return current;  // возвращаем вершину поиска, на которой найден путь
 
-    succ_list.clear();  // очищаем список соседей
-    p->get_successors(v, succ_list);  // теперь наполняем соседями v
-    for (auto edge: succ_list) {  // пересчитываем расстояния до соседей u у вершины v
-        ptrVertex u = edge.first;
-        if (p->ast->was_expanded(u) == 0) {
-            ptrSearchNode new_node = HEAP->new_SearchNode(u);
-            new_node->g = current->g + edge.second;  // новое расстояние до соседа
-            new_node->f = new_node->g + p->heuristic(u);
-            set_parent(p, current, new_node);
-            p->ast->add_to_open(new_node);
-        } else
-            HEAP->delete_Vertex(u);  // если вершина уже раскрыта - удаляем дубликат u
-    }
+    generate_successors(p, current, succ_list);
+    ptrSearchNode goal = insert_successors(p, current, succ_list, BatchHeuristic <T> {p}, p->goal_at_generation);
+    best.update(current);
     
-    p->ast->add_to_closed(current);  // после раскрытия помещаем вершину в список CLOSED
-    return NULL_Node;  // в других случаях (если путь еще не найден), возвращаем NULL
+    p->ast->add_to_closed(current);  // после раскрытия помещаем вершину в список CLOSED (от неё восстанавливается и путь до goal)
+    return goal;  // NULL_Node, если путь еще не найден
 }
 
 
 
 
+static inline ResultSearch with_stats(ResultSearch res, SearchTree *ast1, SearchTree *ast2 = NULL) {
+    /*
+    Данная функция прикладывает к результату res статистику из деревьев поиска ast1 и ast2 (второе дерево
+    есть только в PARALL). Без SEARCH_STATS статистика не собирается, и функция просто возвращает res.
+    */
+
+    STATS(res.stats = ast1->stats;
+          if (ast2 != NULL) res.stats.merge(ast2->stats));
+    (void) ast1;
+    (void) ast2;
+    return res;
+}
+
+
 template <typename T>
-ResultSearch AstarSearch(T *p) {
+ResultSearch AstarSearch(T *p, SearchLimits limits) {
     /*
     Данная функция запускает алгоритм A* с поданными на вход настройками поиска p.
     В качестве T может быть либо StateLatticeParams, либо TypesGraphParams, либо иная структура, у которой есть
     все необходимые настройки для поиска (функции is_goal, get_successors, и тд).
+    Поиск, упёршийся в ограничения limits, останавливается (out_of_time = 1, причина - в stopped) и возвращает
+    в best_node раскрытую вершину, ближайшую к цели по эвристике.
     */
     
     add_start_node_to_open(p);  // создаём и добавляем в OPEN начальную вершину поиска
+    BestByHeuristic best(limits.limited());  // (частичный результат нужен, только если поиск можно остановить)
     
     int step = 0;  // количество шагов алгоритма
-    vector <pair <ptrVertex, long double>> list;  // инициализируем список соседей (один на весь поиск, чтобы не тратить время на его создание)
+    Successors list;  // инициализируем буфер соседей (один на весь поиск, чтобы не тратить время на его создание)
     
     while (p->ast->open_is_empty() == 0) {  // ищем путь, пока OPEN не кончился
         step += 1;
-        ptrSearchNode node = StepAstar(p, list);  // делаем один шаг алгоритма A*
+        if (SearchStop stop = limits.passed(step))
+            return with_stats(stopped_result(step, stop, best.node), p->ast);
+        ptrSearchNode node = StepAstar(p, list, best);  // делаем один шаг алгоритма A*
         if (!(node == NULL_Node))  // если вернули вершину поиска -> путь найден -> выходим из алгоритма
-            return ResultSearch(1, step, node);
+            return with_stats(ResultSearch(1, step, node), p->ast);
     }
 
-    return ResultSearch(0, step, NULL_Node);  // если вышли из while -> так и не нашли путь
+    return with_stats(ResultSearch(0, step, NULL_Node), p->ast);  // если вышли из while -> так и не нашли путь
 }
 
 
+template <typename T>
+ResultSearch AstarSearch(T *p, double time_budget = 0) {
+    /*
+    То же с ограничением только по времени: time_budget секунд (0 - без ограничения).
+    */
+
+    return AstarSearch(p, SearchLimits(time_budget));
+}
+
+
+
+
+template <typename T>
+ResultSearch AstarContinue(T *p, SearchLimits limits) {
+    /*
+    Данная функция продолжает уже построенное дерево поиска p->ast до новой цели (её нужно заранее задать через
+    p->set_finish) - так повторный запрос из того же старта не начинает поиск заново (см. KC_reuse.hpp).
+    Сначала среди уже раскрытых вершин ищется лучшая целевая (по f-значению с новой эвристикой), затем f-значения
+    всех вершин OPEN пересчитываются с новой эвристикой, и A* продолжается, пока лучшая вершина OPEN не окажется
+    хуже найденной раскрытой целевой (или пока не найдётся целевая в OPEN).
+    Если дерево пустое, то сначала в него добавляется стартовая вершина - тогда это в точности AstarSearch.
+    В отличие от AstarSearch, финальная вершина остаётся в дереве (в OPEN или в CLOSED) -> отдельно её удалять не нужно,
+    но путь от неё можно восстанавливать, только пока дерево не продолжено снова (или не удалено).
+    Ограничения limits - как в AstarSearch.
+    */
+
+    if (p->ast->open_is_empty() && p->ast->expanded_nodes.empty())
+        add_start_node_to_open(p);
+
+    ptrSearchNode best = NULL_Node;  // лучшая уже раскрытая целевая вершина
+    long double best_f = 0;
+    for (ptrSearchNode node: p->ast->expanded_nodes)
+        if (p->is_goal(node->vertex)) {
+            long double f = node->g + p->heuristic(node->vertex);
+            if (best == NULL_Node || f < best_f) {
+                best = node;
+                best_f = f;
+            }
+        }
+
+    for (ptrSearchNode node: p->ast->open.nodes())  // пересчитываем f-значения OPEN с новой эвристикой
+        node->f = node->g + p->heuristic(node->vertex);
+    p->ast->reorder_open();
+
+    BestByHeuristic partial(limits.limited());
+    int step = 0;
+    Successors list;
+
+    while (p->ast->open_is_empty() == 0) {
+        step += 1;
+        if (SearchStop stop = limits.passed(step))
+            return with_stats(stopped_result(step, stop, partial.node), p->ast);
+
+        ptrSearchNode current = p->ast->get_best_node_from_open();
+        if (current == NULL_Node)
+            break;
+        if (!(best == NULL_Node) && best_f <= current->f) {  // раскрытая целевая вершина не хуже всего, что осталось в OPEN
+            p->ast->add_to_open(current);
+            break;
+        }
+        if (p->is_goal(current->vertex)) {
+            p->ast->add_to_open(current);  // вершину не раскрыли -> возвращаем её в OPEN (там её и найдёт следующий запрос)
+            return with_stats(ResultSearch(1, step, current), p->ast);
+        }
+
+        expand_node(p, current, list, BatchHeuristic <T> {p});
+        partial.update(current);
+        p->ast->add_to_closed(current);
+    }
+
+    if (!(best == NULL_Node))
+        return with_stats(ResultSearch(1, step, best), p->ast);
+    return with_stats(ResultSearch(0, step, NULL_Node), p->ast);
+}
+
+
+template <typename T>
+ResultSearch AstarContinue(T *p, double time_budget = 0) {
+    return AstarContinue(p, SearchLimits(time_budget));
+}
+
+
+
+static inline void share_goal(StateLatticeParams *p, StateLatticeParams *other) {
+    /*
+    Данная функция передаёт поиску p то, что нужно знать о цели поиска other, чтобы искать путь и до неё тоже:
+    тупиковые состояния, из которых можно доехать до цели other, тоже нельзя отбрасывать (см. KC_deadends.hpp).
+    */
+
+    p->dead_goal_reaching.insert(other->dead_goal_reaching.begin(), other->dead_goal_reaching.end());
+}
+
+
+static inline void share_goal(TypesGraphParams *, TypesGraphParams *) {
+    /*
+    На графе типов последователи не зависят от цели -> передавать нечего.
+    */
+}
 
 
-ResultSearch PARALL(StateLatticeParams *prims, TypesGraphParams *types, int T) {
+template <typename T>
+struct ManyGoalsHeuristic {
+    /*
+    Эвристика AstarSearchMany: минимум эвристик до ещё не достигнутых целей (reached[k] = 0), в обоих видах, что и
+    BatchHeuristic.
+    */
+
+    vector <T*> &goals;
+    vector <char> &reached;
+    vector <long double> &h_k;  // (память под эвристики до одной цели - общая на весь поиск)
+
+    long double operator()(ptrVertex u) const {
+        long double h = -1;
+        for (size_t k = 0; k < goals.size(); k ++)
+            if (reached[k] == 0) {
+                long double h_u = goals[k]->heuristic(u);
+                if (h < 0 || h_u < h)
+                    h = h_u;
+            }
+        return h;
+    }
+
+    void operator()(const int *i, const int *j, int n, long double *h) const {
+        if ((int) h_k.size() < n)
+            h_k.resize(n);
+        fill(h, h + n, -1);
+        for (size_t k = 0; k < goals.size(); k ++)
+            if (reached[k] == 0) {
+                goals[k]->heuristic_batch(i, j, n, h_k.data());
+                for (int m = 0; m < n; m ++)
+                    if (h[m] < 0 || h_k[m] < h[m])
+                        h[m] = h_k[m];
+            }
+    }
+};
+
+
+template <typename T>
+vector <ResultSearch> AstarSearchMany(vector <T*> &goals, SearchLimits limits) {
+    /*
+    Данная функция ищет пути из одного старта сразу до нескольких целей одним деревом поиска (one-to-many).
+    goals[k] - настройки поиска до k-й цели (старт у всех одинаковый): от них берутся is_goal и эвристика, а дерево поиска,
+    старт и последователи - от goals[0] (поэтому остальные настройки стоит создавать с use_fast_closed = false - их
+    деревья поиска не используются, и незачем выделять под них большой битовый CLOSED).
+    Эвристика вершины - минимум эвристик до ещё не достигнутых целей, а вершина, на которой достигнута цель, не
+    завершает поиск, а раскрывается дальше как обычно; поиск идёт, пока не достигнуты все цели (или не кончился OPEN,
+    или поиск не упёрся в ограничения limits). Когда цель достигнута, минимум берётся по меньшему числу целей и может
+    вырасти -> f-значения OPEN пересчитываются, и OPEN заново упорядочивается (как в AstarContinue).
+    Для одной цели это в точности AstarSearch, а для нескольких путь до каждой цели может немного отличаться от
+    отдельного AstarSearch до неё (по стоимости в пределах неточности эвристики): эвристика до целевой области не
+    допустима строго, и порядок раскрытий с общей эвристикой другой.
+    Возвращает результат для каждой цели. В отличие от AstarSearch, финальные вершины лежат в CLOSED дерева goals[0]
+    (путь восстанавливается от них, пока это дерево не удалено) -> отдельно их удалять не нужно.
+    */
+
+    T *p = goals[0];
+    int K = goals.size();
+    for (int k = 1; k < K; k ++)
+        share_goal(p, goals[k]);
+
+    vector <ResultSearch> results(K, ResultSearch(0, 0, NULL_Node));
+    vector <char> reached(K, 0);  // достигнута ли уже k-я цель
+    int remaining = K;
+    vector <long double> h_k;
+    ManyGoalsHeuristic <T> heuristic {goals, reached, h_k};
+
+    ptrSearchNode start_node = HEAP->new_SearchNode(p->get_start_vertex());
+    start_node->g = 0;
+    start_node->f = heuristic(start_node->vertex);
+    p->ast->add_to_open(start_node);
+    BestByHeuristic partial(limits.limited());  // (эвристика - до ближайшей недостигнутой цели)
+
+    int step = 0;
+    SearchStop stopped = STOP_NONE;
+    Successors list;
+
+    while (remaining > 0 && p->ast->open_is_empty() == 0) {
+        step += 1;
+        if ((stopped = limits.passed(step)))
+            break;
+
+        ptrSearchNode current = p->ast->get_best_node_from_open();
+        if (current == NULL_Node)
+            break;
+
+        int reached_now = 0;
+        for (int k = 0; k < K; k ++)  // отмечаем все цели, которых достигли в этой вершине
+            if (reached[k] == 0 && goals[k]->is_goal(current->vertex)) {
+                results[k] = ResultSearch(1, step, current);
+                reached[k] = 1;
+                remaining -= 1;
+                reached_now += 1;
+                current->mem_after_closed = 1;  // от неё будут восстанавливать путь -> из CLOSED не удаляем
+            }
+
+        if (reached_now > 0 && remaining > 0) {  // эвристика выросла -> пересчитываем f-значения OPEN
+            for (ptrSearchNode node: p->ast->open.nodes())
+                node->f = node->g + heuristic(node->vertex);
+            p->ast->reorder_open();
+        }
+
+        if (remaining > 0) {
+            expand_node(p, current, list, heuristic);
+            partial.update(current);
+        }
+        p->ast->add_to_closed(current);
+    }
+
+    for (int k = 0; k < K; k ++) {
+        if (reached[k] == 0)
+            results[k] = (stopped != STOP_NONE) ? stopped_result(step, stopped, partial.node) : ResultSearch(0, step, NULL_Node);
+        results[k] = with_stats(results[k], p->ast);  // статистика общая - дерево одно на все цели
+    }
+    return results;
+}
+
+
+template <typename T>
+vector <ResultSearch> AstarSearchMany(vector <T*> &goals, double time_budget = 0) {
+    return AstarSearchMany(goals, SearchLimits(time_budget));
+}
+
+
+
+
+inline ResultSearch PARALL(StateLatticeParams *prims, TypesGraphParams *types, int T, SearchLimits limits) {
     /*
     Данная функция реализует алгоритм PARALL_T, который производит независимый поиск сразу двумя
     алгоритмами: базовым решением с параметрами prims и альтернативным решением со склеиванием с параметром types.
+    Ограничения limits - как в AstarSearch (шаги считаются общие для обоих поисков, а частичный результат берётся
+    из поиска на state lattice - по нему путь восстанавливается целиком).
     */
 
     add_start_node_to_open(prims);  // добавили начальные вершины в каждое дерево поиска
     add_start_node_to_open(types);
+    BestByHeuristic best_prims(limits.limited()), best_types(false);  // (частичный результат берётся только от prims)
 
     int steps = 0;
-    vector <pair <ptrVertex, long double>> list;
+    Successors list;
 
     while(1) {
         bool use_types = (types->ast->open_is_empty() == 0);  // эта переменная показывает, нужно ли ещё искать поиск альтернативным решением
                                                               // (если OPEN опустел, значит можно остановиться, так как путь он им не найти)
         if (prims->ast->open_is_empty() == 1)  // если OPEN базового решения опустел, значит путь точно не найти
-            return ResultSearch(0, steps, NULL_Node);
+            return with_stats(ResultSearch(0, steps, NULL_Node), prims->ast, types->ast);
 
         steps += 1;
+        if (SearchStop stop = limits.passed(steps))
+            return with_stats(stopped_result(steps, stop, best_prims.node), prims->ast, types->ast);
 
         if (use_types == 1) {  // если нужно, делаем шаги альтернативным решением
-            ptrSearchNode node = StepAstar(types, list);
+            ptrSearchNode node = StepAstar(types, list, best_types);
             if (!(node == NULL_Node))
-                return ResultSearch(1, steps, node);
+                return with_stats(ResultSearch(1, steps, node), prims->ast, types->ast);
         }
         
         if (steps % T == 0 || use_types == 0) {  // раз в T шагов (или если types уже не используем) делаем итерацию базового решения
-            ptrSearchNode node = StepAstar(prims, list);
+            ptrSearchNode node = StepAstar(prims, list, best_prims);
             if (!(node == NULL_Node))
-                return ResultSearch(1, steps, node);
+                return with_stats(ResultSearch(1, steps, node), prims->ast, types->ast);
         }
     }
 }
+
+
+inline ResultSearch PARALL(StateLatticeParams *prims, TypesGraphParams *types, int T, double time_budget = 0) {
+    return PARALL(prims, types, T, SearchLimits(time_budget));
+}
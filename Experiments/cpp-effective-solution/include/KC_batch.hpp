@@ -0,0 +1,106 @@
+/*
+Данный файл описывает пакетный поиск: несколько независимых запросов A* выполняются на одном ядре вперемешку.
+
+Один A* большую часть времени ждёт память: вершины поиска и вершины графа лежат в куче HEAP вразнобой, а биты
+CLOSED разбросаны по всему fast_closed. Но, как уже видно по PARALL, шаги разных поисков легко чередовать. Поэтому
+каждый запрос пакета - это конечный автомат из двух стадий:
+    1) извлечь лучшую вершину из OPEN, проверить цель и сгенерировать соседей, после чего выдать процессору команды
+       предвыборки (prefetch) байтов CLOSED этих соседей;
+    2) (когда до этого запроса снова дойдёт очередь) добавить соседей в OPEN - к этому моменту нужные байты CLOSED
+       уже в кэше, - поместить вершину в CLOSED и подгрузить вершину графа, которая теперь лежит на вершине OPEN.
+Между стадией и её продолжением выполняются стадии остальных запросов пакета, за это время память успевает
+подгрузиться. Каждый запрос ищет ровно то же, что и AstarSearch, - меняется только порядок работы.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "KC_astar.hpp"
+
+using namespace std;
+
+
+
+
+template <typename T>
+vector <ResultSearch> AstarBatch(vector <T*> &queries, SearchLimits limits = SearchLimits(0)) {
+    /*
+    Данная функция выполняет поиски A* для всех настроек queries (у каждого запроса своё дерево поиска) вперемешку на
+    текущем потоке и возвращает результат каждого - такой же, как у AstarSearch (финальную вершину найденного пути
+    нужно удалить отдельно, HEAP->delete_SearchNode). Ограничения limits общие: время - на весь пакет, количество
+    шагов - для каждого запроса отдельно, а память кучи считается по общей куче HEAP текущего потока, то есть вместе
+    по всем запросам пакета (каждый запрос остановится, когда весь пакет займёт больше max_memory).
+    */
+
+    struct Query {
+        int stage;  // 0 - извлечь вершину и сгенерировать соседей, 1 - добавить соседей в OPEN, 2 - поиск закончен
+        int step;
+        ptrSearchNode current;
+        Successors list;
+        BestByHeuristic best;
+    };
+
+    int K = queries.size();
+    vector <Query> state(K);
+    vector <ResultSearch> results(K, ResultSearch(0, 0, NULL_Node));
+    for (int k = 0; k < K; k ++) {
+        add_start_node_to_open(queries[k]);
+        state[k].stage = 0;
+        state[k].step = 0;
+        state[k].best = BestByHeuristic(limits.limited());
+    }
+
+    int active = K;
+    while (active > 0)
+        for (int k = 0; k < K; k ++) {
+            T *p = queries[k];
+            Query &q = state[k];
+
+            if (q.stage == 0) {
+                // шаги считаются так же, как в AstarSearch:
+                if (p->ast->open_is_empty()) {
+                    results[k] = with_stats(ResultSearch(0, q.step, NULL_Node), p->ast);
+                    q.stage = 2;
+                    active -= 1;
+                    continue;
+                }
+                q.step += 1;
+                if (SearchStop stop = limits.passed(q.step)) {
+                    results[k] = with_stats(stopped_result(q.step, stop, q.best.node), p->ast);
+                    q.stage = 2;
+                    active -= 1;
+                    continue;
+                }
+                q.current = p->ast->get_best_node_from_open();
+                if (q.current == NULL_Node)
+                    continue;
+                if (p->is_goal(q.current->vertex)) {
+                    results[k] = with_stats(ResultSearch(1, q.step, q.current), p->ast);
+                    q.stage = 2;
+                    active -= 1;
+                    continue;
+                }
+                generate_successors(p, q.current, q.list);
+                for (int m = 0; m < q.list.size; m ++)
+                    p->ast->prefetch_closed(state_i(q.list.key[m]), state_j(q.list.key[m]), q.list.info[m]);
+                q.stage = 1;
+
+            } else if (q.stage == 1) {
+                ptrSearchNode goal = insert_successors(p, q.current, q.list, BatchHeuristic <T> {p}, p->goal_at_generation);
+                q.best.update(q.current);
+                p->ast->add_to_closed(q.current);
+                if (!(goal == NULL_Node)) {  // цель нашлась среди последователей (goal_at_generation)
+                    results[k] = with_stats(ResultSearch(1, q.step, goal), p->ast);
+                    q.stage = 2;
+                    active -= 1;
+                    continue;
+                }
+                if (p->ast->open_is_empty() == 0)  // эту вершину, скорее всего, извлечём на следующем шаге
+                    __builtin_prefetch(&HEAP->vertexs[p->ast->open.top()->vertex.ind]);
+                q.stage = 0;
+            }
+        }
+
+    return results;
+}
@@ -0,0 +1,56 @@
+/*
+Данный файл описывает предподсчёт "тупиковых" дискретных состояний state lattice для конкретной карты и control set.
+
+Состояние (i, j, theta) называется тупиковым, если из него нельзя ехать бесконечно долго: либо из него не выходит
+ни одного примитива, не задевающего препятствия, либо все такие примитивы ведут в тупиковые же состояния (например,
+узкий коридор, в котором агент не может развернуться). Тупики находятся "обратным" итеративным процессом: сначала
+тупиковыми объявляются состояния без допустимых примитивов, затем у каждого нового тупика перебираются предшественники,
+и предшественник становится тупиком, когда у него не осталось допустимых примитивов в нетупиковые состояния.
+
+Тупиковые состояния хранятся битовой маской (по биту на состояние) и сохраняются на диск рядом с картой (файл .kdead),
+так что предподсчёт делается один раз на пару (карта, control set).
+
+Замечание: в тупике может оказаться и сама цель поиска, поэтому отбрасывать тупиковое состояние можно, только если из
+него не доехать до цели. Из тупика все допустимые примитивы ведут снова в тупики, поэтому такие "опасные" тупики - это
+ровно те, из которых по тупикам можно доехать до целевого тупикового состояния; они находятся перед каждым поиском
+обратным обходом от целевых тупиков (см. StateLatticeParams::collect_dead_goals) - обычно их нет совсем.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "KC_searching.hpp"
+#include "KC_structs.hpp"
+#include "KC_mmap.hpp"
+
+using namespace std;
+
+
+
+
+struct DeadEnds {
+    /*
+    Данная структура хранит битовую маску тупиковых состояний одной карты для одного control set.
+    */
+
+    int height, width;  // размеры карты
+    int theta_amount;  // количество дискретных направлений (как в control set)
+    long long dead_amount;  // количество тупиковых состояний (на свободных клетках)
+    const uint64_t *bits;  // бит номер (i * width + j) * theta_amount + theta равен 1, если состояние (i, j, theta) тупиковое
+
+    DeadEnds();
+    void load_or_compute(Map *map, ControlSet *control_set, string map_file, string cache_file);
+    size_t state(int i, int j, int theta);
+    bool is_dead(int i, int j, int theta);
+
+private:
+    vector <uint64_t> own_bits;  // маска, если она посчитана (а не загружена из кэша)
+    MappedFile mapped;
+
+    void compute(Map *map, ControlSet *control_set);
+    bool load_cache(string map_file, string cache_file, uint64_t control_set_checksum);
+    void save_cache(string map_file, string cache_file, uint64_t control_set_checksum);
+};
@@ -91,6 +91,7 @@ struct MyHEAP {
     MyHEAP();
     void resize();  // функция, которая добавляет больше экземпляров (увеличивает vertexs и nodes), если неиспользуемые закончились
     int get_ind(vector <int> &index);
+    size_t used_bytes();  // сколько байт занимают используемые сейчас экземпляры (для ограничения памяти поиска, см. SearchLimits)
 
     ptrVertex new_Vertex(int i, int j, int theta);  // следующие функции выделяют новый экземпляр Vertex в виде индекса в векторе vertexs (который обёрнут в структуру ptrVeretx)
     ptrVertex new_Vertex(int i, int j, int type, int info);
@@ -0,0 +1,111 @@
+/*
+Данный файл описывает иерархическую абстракцию state lattice (в духе HPA* - Hierarchical Path-Finding A*), которая
+позволяет на больших картах находить путь, не раскрывая всё пространство (i, j, theta).
+
+Карта режется на квадратные кластеры cluster_size x cluster_size. На каждой общей границе двух соседних кластеров
+ищутся отрезки клеток, свободных с обеих сторон границы, и на каждом отрезке выбирается одна (или, если отрезок
+длинный, две) клетка - вход. Вход - это не клетка, а несколько дискретных состояний в ней: с направлениями, которые
+пересекают границу (отличаются от нормали к границе меньше, чем на 45 градусов, в любую из двух сторон). Каждый вход
+принадлежит обоим кластерам.
+
+Затем внутри каждого кластера (точнее, в его окне - кластере, расширенном на margin клеток, чтобы до входов на
+границе можно было доехать примитивами) от каждого входа ищутся пути по state lattice до всех остальных входов того
+же кластера. Найденные пути становятся рёбрами абстрактного графа, и они сохраняются целиком: как номера примитивов
+(номер среди примитивов, выходящих под текущим углом), так что по ребру сразу восстанавливается путь на state lattice.
+
+Запрос (find_path) сначала ищет маленьким A* путь по абстрактному графу, в котором старт соединён со входами своего
+кластера, а входы кластера финиша - с целью рёбрами-оценками (эвристикой). Затем путь уточняется: обычный A* по state
+lattice ищет путь только внутри коридора - окон кластеров старта, финиша и входов абстрактного пути (см.
+StateLatticeParams::area). Если в коридоре пути нет, то пути от старта до входов его кластера и от входов кластера
+финиша до цели ищутся честно (поиском Дейкстры в окнах этих кластеров, до цели - обратным, по предшественникам),
+абстрактный путь ищется заново, и путь склеивается из этих кусков и сохранённых путей по рёбрам.
+
+Абстракция приближённая: путь получается не обязательно оптимальным (он ищется только в коридоре или проходит через
+входы), и путь, который есть на state lattice, может не найтись (например, если для него нужно маневрировать прямо на границе кластеров). Тогда
+стоит искать обычным A*.
+
+Абстракция зависит от карты, control set, размера кластера и режима стоимости (PRIM или COST) и сохраняется рядом с
+картой (файл .khpa, как кэш тупиков .kdead), так что строится один раз.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+#include "KC_searching.hpp"
+#include "KC_structs.hpp"
+#include "KC_astar.hpp"
+#include "KC_mmap.hpp"
+#include "common.hpp"
+
+using namespace std;
+
+
+
+
+struct ResultHierarchy {
+    /*
+    Результат поиска по иерархической абстракции.
+    */
+
+    bool find_path;  // найден ли путь
+    bool out_of_time;  // поиск остановлен из-за ограничения времени
+    int steps;  // сколько состояний раскрыли поиски по state lattice (в коридоре и в кластерах старта и финиша)
+    int abstract_steps;  // сколько вершин раскрыл поиск по абстрактному графу
+    long double cost;  // стоимость пути (-1, если путь не найден)
+    vector <Vertex> path;  // путь на state lattice: все дискретные состояния от старта до целевого
+};
+
+
+
+
+struct Hierarchy {
+    /*
+    Данная структура хранит абстрактный граф одной карты для одного control set.
+    Входы и рёбра хранятся плоскими массивами (как и в ControlSet): рёбра k-го входа - это рёбра с номерами от
+    edge_begin[k] до edge_begin[k+1]-1, путь по e-му ребру - примитивы steps[edge_steps[e]], ..., steps[edge_steps[e+1]-1].
+    */
+
+    int height, width;  // размеры карты
+    int theta_amount;  // количество дискретных направлений
+    int cluster_size;  // размер кластера (в клетках)
+    int margin;  // на сколько клеток окно кластера шире самого кластера
+    int clusters_h, clusters_w;  // количество кластеров по вертикали и горизонтали
+    string mode;  // PRIM или COST - стоимость рёбер (как в StateLatticeParams)
+
+    int entrances_amount;
+    const int *entrance_i, *entrance_j, *entrance_theta;  // дискретные состояния входов
+    const int *cluster_begin;  // clusters_h * clusters_w + 1 чисел: входы кластера c - это cluster_entrances[cluster_begin[c]...]
+    const int *cluster_entrances;
+    const int *edge_begin;  // entrances_amount + 1 чисел
+    const int *edge_to;  // в какой вход ведёт ребро
+    const long double *edge_cost;  // стоимость ребра
+    const int *edge_steps;  // (количество рёбер + 1) чисел
+    const uint16_t *steps;  // номера примитивов путей по рёбрам
+
+    Hierarchy();
+    void load_or_build(Map *map, ControlSet *control_set, string map_file, string cache_file,
+                       int cluster_size = HIERARCHY_CLUSTER_SIZE, string mode = "COST");
+    int cluster_of(int i, int j);
+    ResultHierarchy find_path(Map *map, ControlSet *control_set, Vertex *start, Vertex *finish,
+                              long double R = 3.0, int A = 1, double time_budget = 0);
+
+private:
+    vector <int> own_entrance_i, own_entrance_j, own_entrance_theta, own_cluster_begin, own_cluster_entrances;
+    vector <int> own_edge_begin, own_edge_to, own_edge_steps;
+    vector <long double> own_edge_cost;
+    vector <uint16_t> own_steps;
+    MappedFile mapped;
+
+    void build(Map *map, ControlSet *control_set);
+    void find_entrances(Map *map, ControlSet *control_set);
+    void cluster_window(int c, int &i0, int &j0, int &i1, int &j1);
+    bool abstract_search(StateLatticeParams *params, const vector <pair <int, long double>> &from_start,
+                         const unordered_map <int, long double> &to_goal, long double direct,
+                         vector <int> &chain, vector <int> &chain_edges, long double &cost, int &steps_done);
+    bool load_cache(string map_file, string cache_file, uint64_t control_set_checksum);
+    void save_cache(string map_file, string cache_file, uint64_t control_set_checksum);
+};
@@ -0,0 +1,83 @@
+/*
+Данный файл описывает работу с заранее скомпилированными бинарными файлами (control set, типы и тд).
+Такой файл не читается построчно, а целиком отображается в память через mmap: операционная система сама подгружает
+нужные страницы файла, а программа работает с массивами прямо внутри отображённой памяти, ничего не копируя.
+Кроме того, если один и тот же файл отображают несколько процессов (как при тестировании через fork), то в
+физической памяти он хранится в единственном экземпляре.
+
+Все бинарные файлы устроены одинаково: сначала заголовок (у каждого вида файла свой, но всегда начинается с
+8-байтовой сигнатуры и номера версии формата), а затем массивы, начало каждого из которых выровнено на BINARY_ALIGN байт.
+*/
+
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+#define BINARY_ALIGN 16  // выравнивание массивов внутри бинарных файлов
+
+
+
+
+struct MappedFile {
+    /*
+    Данная структура описывает файл, отображённый в память только для чтения.
+    */
+
+    const uint8_t *data;  // начало отображённой памяти (NULL, если файл не открыт)
+    size_t size;  // размер файла в байтах
+
+    MappedFile();
+    bool open(string file);
+    void close();
+    ~MappedFile();
+
+    template <typename T>
+    const T *at(size_t offset) const {
+        /*
+        Возвращает указатель на массив элементов типа T, который начинается со смещения offset внутри файла.
+        */
+
+        return (const T *) (data + offset);
+    }
+};
+
+
+bool file_starts_with(string file, const char *magic);  // проверяет, что файл начинается с 8-байтовой сигнатуры magic
+bool file_stamp(string file, uint64_t &size, int64_t &mtime);  // размер и время последнего изменения файла (чтобы замечать устаревшие кэши)
+uint64_t checksum64(const void *data, size_t size);  // контрольная сумма куска памяти (чтобы замечать повреждённые файлы)
+
+
+
+
+struct BinaryWriter {
+    /*
+    Вспомогательная структура для записи бинарного файла: складывает массивы друг за другом с нужным выравниванием
+    и запоминает их смещения (которые затем записываются в заголовок).
+    */
+
+    vector <uint8_t> bytes;  // содержимое файла
+
+    BinaryWriter(size_t header_size);
+
+    template <typename T>
+    uint64_t add_array(const T *array, size_t n) {
+        /*
+        Дописывает в конец массив array из n элементов (предварительно выровняв конец на BINARY_ALIGN) и возвращает его смещение.
+        */
+
+        while (bytes.size() % BINARY_ALIGN != 0)
+            bytes.push_back(0);
+        uint64_t offset = bytes.size();
+        const uint8_t *raw = (const uint8_t *) array;
+        bytes.insert(bytes.end(), raw, raw + n * sizeof(T));
+        return offset;
+    }
+
+    void save(string file, const void *header, size_t header_size);
+};
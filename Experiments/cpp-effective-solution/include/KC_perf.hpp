@@ -0,0 +1,45 @@
+/*
+Данный файл описывает чтение аппаратных счётчиков производительности процессора (такты, инструкции, промахи
+кэша L1 и LLC, ошибки предсказания ветвлений, промахи dTLB) через системный вызов perf_event_open (есть только в Linux).
+Это позволяет увидеть, например, сколько промахов кэша порождают обращения HEAP->vertexs[...] или большой fast_closed.
+
+Чтение счётчиков включается объявлением переменной PERF_COUNTERS в файле common.hpp. Если она не объявлена, или
+счётчики недоступны (не Linux, запрещено настройкой kernel.perf_event_paranoid, запуск в контейнере и тд), то
+все функции просто ничего не делают, а значения счётчиков остаются равными -1 (и в файл результатов не выводятся).
+
+Аппаратных счётчиков в процессоре мало, и если событий больше (или счётчики заняты кем-то ещё, например, perf),
+то ядро включает события по очереди (мультиплексирование), и каждое считается только часть времени замера. Поэтому
+вместе со значением читается, сколько времени событие было включено и сколько реально считалось, и значение
+масштабируется на их отношение (в running_share остаётся доля времени, которую счётчик реально считал).
+*/
+
+#pragma once
+
+#include "common.hpp"
+
+using namespace std;
+
+#define PERF_EVENTS_NUM 6  // сколько всего счётчиков читаем
+
+
+
+
+struct PerfCounters {
+    /*
+    Данная структура хранит открытые счётчики и их значения после очередного замера.
+    Использование: start() перед замеряемым участком кода, stop() после него, затем значения берутся из values.
+    */
+
+    int fds[PERF_EVENTS_NUM];  // файловые дескрипторы счётчиков (-1, если счётчик открыть не удалось)
+    long long values[PERF_EVENTS_NUM];  // значения счётчиков за последний замер (-1, если счётчик недоступен)
+    double running_share[PERF_EVENTS_NUM];  // какую долю замера счётчик реально считал (1 - без мультиплексирования)
+    bool available;  // удалось ли открыть хотя бы один счётчик
+
+    PerfCounters();
+    void start();
+    void stop();
+    ~PerfCounters();
+
+private:
+    unsigned long long enabled_at_start[PERF_EVENTS_NUM], running_at_start[PERF_EVENTS_NUM];  // (сброс их не обнуляет)
+};
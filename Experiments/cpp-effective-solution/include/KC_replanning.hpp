@@ -0,0 +1,422 @@
+/*
+Данный файл описывает инкрементальный поиск пути (LPA* - Lifelong Planning A*), который после изменения карты не ищет
+путь заново, а исправляет уже посчитанное.
+
+Обычный A* после того, как на карте появилось (или исчезло) препятствие, приходится запускать с нуля. LPA* хранит для
+каждой затронутой вершины два значения: g (расстояние от старта, посчитанное при последнем раскрытии) и rhs
+(минимум g(предшественник) + стоимость ребра по текущему графу). Вершина "согласована", если g = rhs. Изменение
+клетки карты меняет допустимость только тех рёбер, чей след проходит через эту клетку (на state lattice - коллизионный
+след примитива, на графе типов - клетка ячейки, в которую ведёт ребро; их перечисляет get_affected у настроек поиска).
+У концов таких рёбер пересчитывается rhs, несогласованные вершины попадают в очередь, и поиск (в порядке ключей,
+как в A*) раскрывает только их и то, что от них зависит, пока путь до цели снова не станет точным.
+
+Использование:
+    IncrementalSearch <StateLatticeParams> replan(p);  // p - обычные настройки поиска (старт и цель не меняются)
+    ResultReplan res = replan.search();                // первый поиск - по сути A*
+    vector <pair <int, int>> changed = map->set_cells(updates);
+    replan.cells_changed(changed);
+    res = replan.search();                             // исправление пути
+Настройки поиска должны уметь, кроме обычного, перечислять предшественников (get_predecessors) и рёбра, зависящие от
+клетки (get_affected). Их дерево поиска p->ast не используется (его стоит создавать с use_fast_closed = false).
+Маску тупиков (KC_deadends.hpp) вместе с изменением карты использовать нельзя: она считалась для старой карты.
+На графе типов вершины не склеиваются (вершина - это клетка и тип, а не клетка и info): склеивание зависит от порядка
+раскрытия, а у LPA* этот порядок меняется от изменения к изменению. Если меняется старт (агент поехал), то
+инкрементальный поиск нужно создать заново.
+*/
+
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+
+#include "KC_astar.hpp"
+
+using namespace std;
+
+
+
+
+struct ResultReplan {
+    /*
+    Результат инкрементального поиска.
+    */
+
+    bool find_path;  // найден ли путь
+    bool out_of_time;  // поиск остановлен ограничением (следующий вызов search продолжит с того же места)
+    int steps;  // сколько вершин обработано (раскрыто) за этот вызов
+    long double cost;  // стоимость пути (-1, если путь не найден)
+    vector <Vertex> path;  // сам путь от старта до целевой вершины (все вершины графа по порядку)
+};
+
+
+
+
+template <typename T>
+struct IncrementalSearch {
+    /*
+    Данная структура хранит состояние LPA* для настроек поиска типа T (StateLatticeParams или TypesGraphParams).
+    Все цели (вершины, где is_goal = 1) соединены рёбрами стоимости 0 с одной "виртуальной" целью, её значения -
+    goal_g и goal_rhs; поиск закончен, когда виртуальная цель согласована и её ключ меньше ключа любой вершины очереди.
+    Чтобы рёбра в виртуальную цель не нарушали согласованность эвристики, в ключах используется эвристика настроек,
+    уменьшенная на её максимум goal_h по целевым клеткам (и не меньше 0): на целевых вершинах она равна 0, а
+    допустимой и согласованной остаётся (эвристика - расстояние до finish, а все цели лежат в радиусе R от него).
+    */
+
+    struct Node {
+        Vertex v;
+        long double g, rhs;
+        long double h;  // эвристика (считается один раз при создании вершины, см. goal_h)
+        bool goal;  // является ли вершина целевой
+        Node(Vertex v) : v(v) {}
+    };
+
+    struct QueueItem {  // запись очереди; устаревшие записи (ключ вершины с тех пор изменился) просто пропускаются
+        long double k1, k2;
+        uint64_t key;
+    };
+
+    struct QueueCompare {
+        bool operator() (const QueueItem &a, const QueueItem &b) const {
+            return a.k1 > b.k1 || (a.k1 == b.k1 && a.k2 > b.k2);  // наверху очереди - наименьший ключ
+        }
+    };
+
+    static constexpr long double INF = 1e30;  // "бесконечное" расстояние (с -ffast-math настоящая бесконечность не годится)
+    static constexpr long double EPS = 1e-9;  // точность сравнения расстояний
+
+    T *p;
+    unordered_map <uint64_t, Node> nodes;  // все затронутые поиском вершины (по упакованному номеру, см. key_of)
+    priority_queue <QueueItem, vector <QueueItem>, QueueCompare> queue;  // несогласованные вершины
+    uint64_t start_key;
+    vector <uint64_t> goal_keys;  // все созданные целевые вершины
+    long double goal_g, goal_rhs;  // значения виртуальной цели
+    long double goal_h;  // максимум эвристики настроек по клеткам в радиусе R от finish
+    long long repaired;  // сколько раз rhs пересчитывался из-за изменения карты (за всё время)
+
+    Successors succ_list, pred_list;  // буферы соседей (одни на весь поиск)
+
+
+    IncrementalSearch(T *p) {
+        /*
+        Конструктор. Старт (p->get_start_vertex()) получает rhs = 0 и сразу попадает в очередь.
+        */
+
+        this->p = p;
+        goal_g = goal_rhs = INF;
+        repaired = 0;
+
+        goal_h = 0;
+        int r = (int) p->R;
+        for (int di = -r; di <= r; di ++)
+            for (int dj = -r; dj <= r; dj ++)
+                if (di * di + dj * dj <= p->R * p->R) {  // эвристика зависит только от клетки вершины
+                    ptrVertex v = HEAP->new_Vertex(p->finish->i + di, p->finish->j + dj, p->finish->theta);
+                    goal_h = max(goal_h, p->heuristic(v));
+                    HEAP->delete_Vertex(v);
+                }
+
+        ptrVertex s = p->get_start_vertex();
+        Node &start = touch(s);
+        HEAP->delete_Vertex(s);
+        start_key = key_of(start.v);
+        start.rhs = 0;
+        push(start);
+    }
+
+
+    ResultReplan search(SearchLimits limits) {
+        /*
+        Данная функция доводит поиск до точного пути (с учётом всех изменений карты, о которых сообщили через
+        cells_changed) и возвращает его. Если поиск упёрся в ограничения limits (см. SearchLimits в KC_astar.hpp), то
+        возвращается out_of_time = 1, а следующий вызов продолжит с того же места.
+        */
+
+        ResultReplan res;
+        res.find_path = 0;
+        res.out_of_time = 0;
+        res.cost = -1;
+        int step = 0;
+
+        while (1) {
+            drop_stale();
+            long double goal_k = min(goal_g, goal_rhs);
+            bool goal_first = queue.empty() || goal_k < queue.top().k1 - EPS ||
+                              (goal_k <= queue.top().k1 + EPS && goal_k < queue.top().k2 - EPS);  // ключ цели меньше ключа очереди
+                              // (при равенстве сначала обрабатываем очередь: в ней может быть целевая вершина, чей g устарел;
+                              // равенство проверяем с точностью EPS, так как g и h складываются с ошибками округления)
+
+            if (goal_first && goal_g == goal_rhs)  // путь до цели точный
+                break;
+            if (goal_first) {  // "раскрываем" виртуальную цель
+                goal_g = (goal_g > goal_rhs) ? goal_rhs : INF;
+                continue;
+            }
+
+            step += 1;
+            if (limits.passed(step)) {
+                res.out_of_time = 1;
+                res.steps = step;
+                return res;
+            }
+
+            QueueItem item = queue.top();
+            queue.pop();
+            process(nodes.at(item.key));
+        }
+
+        res.steps = step;
+        if (goal_g >= INF)
+            return res;
+        res.find_path = 1;
+        res.cost = goal_g;
+        res.path = extract_path();
+        return res;
+    }
+
+
+    ResultReplan search(double time_budget = 0) {
+        return search(SearchLimits(time_budget));
+    }
+
+
+    void cells_changed(const vector <pair <int, int>> &cells) {
+        /*
+        Данная функция сообщает поиску, что клетки cells карты изменились (см. Map::set_cells). Пересчитывается rhs
+        только у концов тех рёбер, которые проходят через эти клетки и выходят из вершин с уже посчитанным g (если
+        g начала ребра бесконечно, то ребро на rhs конца не влияет, а если начало ещё в очереди, то при раскрытии оно
+        само учтёт текущие рёбра). Сам путь исправляется при следующем вызове search.
+        */
+
+        vector <pair <Vertex, Vertex>> edges;
+        vector <pair <uint64_t, Vertex>> targets;
+        for (auto &c: cells) {
+            edges.clear();
+            p->get_affected(c.first, c.second, edges);
+            for (auto &e: edges) {
+                auto it = nodes.find(key_of(e.first));
+                if (it != nodes.end() && it->second.g < INF)
+                    targets.push_back({key_of(e.second), e.second});
+            }
+        }
+
+        sort(targets.begin(), targets.end(), [](const pair <uint64_t, Vertex> &a, const pair <uint64_t, Vertex> &b) {
+            return a.first < b.first;
+        });
+        for (size_t k = 0; k < targets.size(); k ++) {
+            if (k > 0 && targets[k].first == targets[k-1].first)
+                continue;  // одна и та же вершина может быть концом многих рёбер
+            ptrVertex u = to_heap(targets[k].second);
+            Node &node = touch(u);
+            HEAP->delete_Vertex(u);
+            update_rhs(node);
+            repaired += 1;
+        }
+    }
+
+
+    size_t nodes_amount() {
+        /*
+        Сколько вершин сейчас хранит поиск.
+        */
+
+        return nodes.size();
+    }
+
+
+private:
+    static uint64_t key_of(const Vertex &v) {
+        /*
+        Упаковывает вершину в одно число: i и j (по 22 бита) и угол (на state lattice) или тип (на графе типов).
+        */
+
+        return pack_state(v.i, v.j, (v.type == -1) ? v.theta : v.type);  // (так же упакованы ключи последователей)
+    }
+
+
+    static Vertex plain(ptrVertex u) {
+        /*
+        Копирует вершину u из кучи HEAP в обычную переменную.
+        */
+
+        if (u->type == -1)
+            return Vertex(u->i, u->j, u->theta);
+        return Vertex(u->i, u->j, u->type, u->info);
+    }
+
+
+    static ptrVertex to_heap(const Vertex &v) {
+        /*
+        Создаёт копию вершины v в куче HEAP (в таком виде вершины принимают настройки поиска).
+        */
+
+        if (v.type == -1)
+            return HEAP->new_Vertex(v.i, v.j, v.theta);
+        return HEAP->new_Vertex(v.i, v.j, v.type, v.info);
+    }
+
+
+    Node &touch(uint64_t key, int info) {
+        /*
+        Возвращает вершину поиска для вершины графа с ключом key и информацией для склеивания info (создаёт её с
+        g = rhs = INF, если её ещё нет; только тогда вершина графа ненадолго создаётся и в куче HEAP).
+        */
+
+        auto it = nodes.find(key);
+        if (it != nodes.end())
+            return it->second;
+
+        ptrVertex u = p->new_vertex(key, info);
+        Node node(plain(u));
+        node.g = node.rhs = INF;
+        node.goal = p->is_goal(u);
+        node.h = node.goal ? 0 : max((long double) 0, p->heuristic(u) - goal_h);
+        HEAP->delete_Vertex(u);
+        if (node.goal)
+            goal_keys.push_back(key);
+        return nodes.emplace(key, node).first->second;
+    }
+
+
+    Node &touch(ptrVertex u) {
+        return touch(key_of(plain(u)), u->info);
+    }
+
+
+    void push(Node &node) {
+        /*
+        Кладёт вершину в очередь, если она несогласована.
+        */
+
+        if (node.g == node.rhs)
+            return;
+        long double k2 = min(node.g, node.rhs);
+        queue.push({k2 + node.h, k2, key_of(node.v)});
+    }
+
+
+    void drop_stale() {
+        /*
+        Убирает с верха очереди устаревшие записи: вершина уже согласована или её ключ изменился.
+        */
+
+        while (!queue.empty()) {
+            const QueueItem &item = queue.top();
+            Node &node = nodes.at(item.key);
+            long double k2 = min(node.g, node.rhs);
+            if (node.g != node.rhs && item.k2 == k2 && item.k1 == k2 + node.h)
+                return;
+            queue.pop();
+        }
+    }
+
+
+    void set_g(Node &node, long double g) {
+        /*
+        Меняет g вершины (и, если вершина целевая, rhs виртуальной цели - минимум g по целевым вершинам).
+        */
+
+        node.g = g;
+        if (!node.goal)
+            return;
+        goal_rhs = INF;
+        for (uint64_t key: goal_keys)
+            goal_rhs = min(goal_rhs, nodes.at(key).g);
+    }
+
+
+    void update_rhs(Node &node) {
+        /*
+        Пересчитывает rhs вершины по всем её предшественникам и, если нужно, кладёт её в очередь.
+        */
+
+        if (key_of(node.v) != start_key) {
+            node.rhs = INF;
+            ptrVertex u = to_heap(node.v);
+            pred_list.reserve(p->max_degree);
+            pred_list.clear();
+            p->get_predecessors(u, pred_list);
+            HEAP->delete_Vertex(u);
+            for (int k = 0; k < pred_list.size; k ++) {
+                auto it = nodes.find(pred_list.key[k]);
+                if (it != nodes.end() && it->second.g < INF)
+                    node.rhs = min(node.rhs, it->second.g + pred_list.cost[k]);
+            }
+        }
+        push(node);
+    }
+
+
+    void process(Node &node) {
+        /*
+        Обрабатывает (раскрывает) несогласованную вершину с наименьшим ключом.
+        */
+
+        ptrVertex u = to_heap(node.v);
+        succ_list.reserve(p->max_degree);
+        succ_list.clear();
+        p->get_successors(u, succ_list);
+        HEAP->delete_Vertex(u);
+
+        if (node.g > node.rhs) {  // стала ближе: g = rhs, а соседи, возможно, тоже приблизились
+            set_g(node, node.rhs);
+            for (int k = 0; k < succ_list.size; k ++) {
+                Node &s = touch(succ_list.key[k], succ_list.info[k]);
+                if (succ_list.key[k] != start_key && node.g + succ_list.cost[k] < s.rhs) {
+                    s.rhs = node.g + succ_list.cost[k];
+                    push(s);
+                }
+            }
+        } else {  // стала дальше: g = INF, а соседям, чей rhs шёл через неё, пересчитываем rhs
+            long double old_g = node.g;
+            set_g(node, INF);
+            update_rhs(node);
+            for (int k = 0; k < succ_list.size; k ++) {
+                auto it = nodes.find(succ_list.key[k]);  // у ещё не созданных вершин rhs = INF - пересчитывать нечего
+                if (it != nodes.end() && it->second.rhs >= old_g + succ_list.cost[k] - EPS)
+                    update_rhs(it->second);
+            }
+        }
+    }
+
+
+    vector <Vertex> extract_path() {
+        /*
+        Восстанавливает путь от лучшей целевой вершины до старта: из каждой вершины переходим в предшественника,
+        на котором достигается минимум g(предшественник) + стоимость ребра.
+        */
+
+        uint64_t key = goal_keys[0];
+        for (uint64_t k: goal_keys)
+            if (nodes.at(k).g < nodes.at(key).g)
+                key = k;
+
+        vector <Vertex> path;
+        path.push_back(nodes.at(key).v);
+        while (key != start_key && path.size() <= nodes.size()) {
+            ptrVertex u = to_heap(nodes.at(key).v);
+            pred_list.reserve(p->max_degree);
+            pred_list.clear();
+            p->get_predecessors(u, pred_list);
+            HEAP->delete_Vertex(u);
+
+            uint64_t best = key;
+            long double best_g = INF;
+            for (int k = 0; k < pred_list.size; k ++) {
+                auto it = nodes.find(pred_list.key[k]);
+                if (it != nodes.end() && it->second.g + pred_list.cost[k] < best_g) {
+                    best = it->first;
+                    best_g = it->second.g + pred_list.cost[k];
+                }
+            }
+            if (best == key)
+                break;  // так быть не должно: у вершины с конечным g всегда есть предшественник
+            key = best;
+            path.push_back(nodes.at(key).v);
+        }
+        reverse(path.begin(), path.end());
+        return path;
+    }
+};
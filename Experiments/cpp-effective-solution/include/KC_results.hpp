@@ -0,0 +1,81 @@
+/*
+Данный файл описывает запись результатов тестирования в машиночитаемом виде. Каждый запуск алгоритма на тесте
+(пара (тест, алгоритм)) превращается в одну запись ResultRecord, в которой собраны все метрики: найден ли путь,
+количество шагов, стоимость, время работы, статистика поиска (KC_stats.hpp) и аппаратные счётчики (KC_perf.hpp).
+
+Записи складываются в ResultWriter, который сохраняет их в файл в одном из форматов:
+    CSV   - обычная таблица с заголовком (читается, например, через pandas.read_csv),
+    JSONL - по одному JSON-объекту на строку (pandas.read_json(file, lines=True)),
+    BIN   - компактный бинарный поколоночный формат (описан перед функцией ResultWriter::write_binary),
+    TXT   - старый текстовый формат ("result PRIM: ...", "time PRIMS: ..."), который разбирают ноутбуки в process_results.
+Само форматирование и запись в файл делаются отдельным фоновым потоком, а основной поток только кладёт записи в
+буфер - поэтому ввод-вывод не искажает замеры времени.
+*/
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "KC_stats.hpp"
+#include "KC_perf.hpp"
+
+using namespace std;
+
+
+
+
+struct ResultRecord {
+    /*
+    Все метрики одного запуска алгоритма на одном тесте.
+    */
+
+    int test;  // номер теста
+    int start_i, start_j, start_theta;  // стартовое и целевое дискретные состояния теста
+    int goal_i, goal_j, goal_theta;
+    string algorithm;  // PRIM, COST, TYPES, PARALL
+    int param;  // параметр алгоритма (T у PARALL_T, у остальных 0)
+    bool find_path;  // найден ли путь
+    bool rejected;  // поиск не запускался, так как старт и финиш в разных компонентах связности (см. may_reach)
+    int steps;  // количество шагов алгоритма
+    double cost;  // стоимость найденного пути (-1, если путь не найден)
+    double time;  // время работы в секундах
+    SearchStats stats;  // статистика поиска (нули, если SEARCH_STATS не объявлен)
+    long long perf[PERF_EVENTS_NUM];  // аппаратные счётчики (-1, если недоступны)
+
+    ResultRecord();
+};
+
+
+
+
+struct ResultWriter {
+    /*
+    Буферизованная запись ResultRecord в файл фоновым потоком.
+    */
+
+    string format;  // CSV, JSONL, BIN или TXT
+    FILE *file;
+
+    vector <ResultRecord> pending;  // записи, которые основной поток уже добавил, а фоновый ещё не обработал
+    vector <ResultRecord> all_records;  // (только для BIN) все записи - поколоночный файл пишется целиком в конце
+    bool finished;  // основной поток больше не будет добавлять записи
+    int last_test;  // (только для TXT) номер теста, чей заголовок выведен последним
+
+    mutex lock;  // защищает pending и finished
+    condition_variable has_work;
+    thread worker;  // фоновый поток, который форматирует и пишет
+
+    ResultWriter(string file_name, string format);
+    void write(const ResultRecord &record);
+    void close();
+    ~ResultWriter();
+
+    void worker_loop();
+    void format_record(const ResultRecord &record, string &out);
+    void write_binary();
+};
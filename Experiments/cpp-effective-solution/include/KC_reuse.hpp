@@ -0,0 +1,185 @@
+/*
+Данный файл описывает кэш деревьев поиска для повторных запросов из одного и того же старта.
+
+Часто из одного положения робота ищут пути сразу до многих целей. Дерево поиска, построенное для первой цели, уже
+содержит кратчайшие пути до всех раскрытых вершин -> следующий запрос из того же старта (и с теми же настройками
+поиска) не начинает поиск заново, а продолжает это дерево: меняет цель (set_finish), пересчитывает OPEN с новой
+эвристикой и продолжает A* (см. AstarContinue в KC_astar.hpp). Пересчёт OPEN стоит O(размер OPEN), поэтому выгода
+тем больше, чем больше новых раскрытий сберегает уже построенное дерево.
+
+Деревья хранятся по ключу, который выбирает вызывающий (в него должно входить всё, от чего зависит дерево: карта,
+control set или типы, алгоритм, старт, R и A). Память ограничена: если деревья вместе занимают больше, чем max_nodes
+вершин поиска, то удаляются давно не использованные деревья. Память считается в байтах (см. memory_bytes) и
+включает не только вершины поиска, но и то, что каждое дерево занимает независимо от их количества (битовый CLOSED
+на всю карту, растр целевой области, сами настройки поиска), - иначе много маленьких деревьев занимали бы сколько
+угодно памяти. Кэш использует кучу HEAP текущего потока, поэтому у каждого потока должен быть свой кэш.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "KC_astar.hpp"
+
+using namespace std;
+
+
+
+
+template <typename T>
+struct SearchTreeCache {
+    /*
+    Данная структура хранит сохранённые деревья поиска (вместе с настройками поиска типа T - StateLatticeParams или
+    TypesGraphParams).
+    */
+
+    struct Entry {
+        string key;  // ключ дерева (см. выше)
+        Vertex *start, *finish;  // старт и текущая цель (на них указывают настройки p -> храним свои копии)
+        T *p;  // настройки поиска вместе с деревом p->ast
+        long long last_use;  // номер запроса, в котором дерево использовалось в последний раз
+    };
+
+    vector <Entry> entries;
+    size_t max_nodes;  // сколько всего вершин поиска (в пересчёте на байты - SearchTree::node_bytes) могут занимать деревья кэша
+    long long queries;  // сколько было запросов (нужно, чтобы найти давно не использованные деревья)
+    long long reused;  // сколько запросов продолжили уже готовое дерево
+
+    SearchTreeCache(size_t max_nodes) {
+        this->max_nodes = max_nodes;
+        queries = 0;
+        reused = 0;
+    }
+
+
+    ResultSearch search(string key, Vertex start, Vertex finish, function <T*(Vertex *, Vertex *)> make, double time_budget = 0) {
+        /*
+        Данная функция ищет путь из start в finish деревом с ключом key: если такое дерево есть, то оно продолжается до
+        новой цели, иначе создаётся новое - настройки поиска создаёт make(start, finish) (указатели на start и finish
+        живут, пока живёт дерево).
+        Финальная вершина результата остаётся в дереве -> удалять её не нужно, но путь от неё можно восстанавливать
+        только до следующего вызова search или clear.
+        */
+
+        queries += 1;
+        shrink();  // ограничение памяти проверяем до поиска, чтобы не удалить дерево, от которого восстанавливают путь
+
+        int k = find(key);
+        if (k != -1) {
+            *entries[k].finish = finish;
+            if (entries[k].p->set_finish(entries[k].finish))
+                reused += 1;
+            else {  // дерево строилось с отбрасыванием тупиков, нужных для новой цели -> строим заново
+                drop(k);
+                k = -1;
+            }
+        }
+        if (k == -1) {
+            Entry e;
+            e.key = key;
+            e.start = new Vertex(start.i, start.j, start.theta);
+            e.finish = new Vertex(finish.i, finish.j, finish.theta);
+            e.p = make(e.start, e.finish);
+            entries.push_back(e);
+            k = entries.size() - 1;
+        }
+
+        entries[k].last_use = queries;
+        return AstarContinue(entries[k].p, time_budget);
+    }
+
+
+    size_t nodes_amount() {
+        /*
+        Сколько вершин поиска сейчас занимают все деревья кэша.
+        */
+
+        size_t total = 0;
+        for (Entry &e: entries)
+            total += e.p->ast->nodes_amount();
+        return total;
+    }
+
+
+    size_t memory_bytes() {
+        /*
+        Оценка памяти всех деревьев кэша в байтах: деревья поиска (SearchTree::memory_bytes), настройки поиска с растром
+        целевой области, копии старта и цели и ключи.
+        */
+
+        size_t total = 0;
+        for (Entry &e: entries)
+            total += e.p->ast->memory_bytes() + sizeof(T) + e.p->goal_region.window.capacity() * sizeof(uint32_t) +
+                     2 * sizeof(Vertex) + sizeof(Entry) + e.key.capacity();
+        return total;
+    }
+
+
+    void invalidate(string key) {
+        /*
+        Удаляет дерево с ключом key (если оно есть) - например, если изменилась карта.
+        */
+
+        int k = find(key);
+        if (k != -1)
+            drop(k);
+    }
+
+
+    void shrink() {
+        /*
+        Удаляет давно не использованные деревья, пока все деревья вместе занимают больше памяти, чем max_nodes вершин
+        поиска.
+        Вызывается в начале search, а также его стоит вызывать, когда результат последнего поиска больше не нужен
+        (тогда лишняя память освобождается сразу, а не при следующем запросе).
+        */
+
+        while (!entries.empty() && memory_bytes() > max_nodes * SearchTree::node_bytes()) {
+            int oldest = 0;
+            for (size_t k = 1; k < entries.size(); k ++)
+                if (entries[k].last_use < entries[oldest].last_use)
+                    oldest = k;
+            drop(oldest);
+        }
+    }
+
+
+    void clear() {
+        /*
+        Удаляет все деревья.
+        */
+
+        while (!entries.empty())
+            drop(entries.size() - 1);
+    }
+
+
+    ~SearchTreeCache() {
+        clear();
+    }
+
+
+private:
+    int find(string key) {
+        for (size_t k = 0; k < entries.size(); k ++)
+            if (entries[k].key == key)
+                return k;
+        return -1;
+    }
+
+
+    void drop(int k) {
+        /*
+        Удаляет k-е дерево вместе с его настройками поиска.
+        */
+
+        delete entries[k].p->ast;
+        delete entries[k].p;
+        delete entries[k].start;
+        delete entries[k].finish;
+        entries.erase(entries.begin() + k);
+    }
+
+};
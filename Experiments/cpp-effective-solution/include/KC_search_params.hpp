@@ -2,6 +2,33 @@
 #include "KC_heap.hpp"
 #include "KC_searching.hpp"
 
+struct DeadEnds;
+
+
+
+
+struct GoalRegion {
+    /*
+    Данная структура хранит целевую область поиска, растеризованную один раз на запрос (и при смене цели): для каждой
+    клетки квадрата со стороной 2R+1 вокруг финиша (обрезанного по границам карты) - маску углов goal_window, если
+    клетка не дальше R от финиша, и 0 иначе. Тогда проверка цели - это проверка границ и одна операция AND с углом
+    (на state lattice) или с маской углов типа (на графе типов) - без вычисления расстояния.
+    */
+
+    int i0, j0;  // левый верхний угол квадрата
+    int height, width;
+    vector <uint32_t> window;  // window[(i - i0) * width + (j - j0)]
+
+    void build(Map *map, Vertex *finish, long double R, uint32_t goal_window);
+
+    inline uint32_t at(int i, int j) const {
+        unsigned di = i - i0, dj = j - j0;  // (отрицательные сдвиги превращаются в большие числа - одна проверка на границу)
+        if (di >= (unsigned) height || dj >= (unsigned) width)
+            return 0;
+        return window[di * width + dj];
+    }
+};
+
 
 
 
@@ -20,6 +47,9 @@ struct StateLatticeParams {
     Vertex *start, *finish;  // указатели на дискретные состояния (в виде Vertex), между которыми искать траекторию на state lattice
     long double R;  // R и A - параметры, которые указывают, какие именно вершины считать целевыми относительно finish (до каких искать путь)
     int A;
+    uint32_t goal_window;  // битовая маска углов, которые (с точки зрения меры A) подходят к finish->theta
+    GoalRegion goal_region;  // целевые клетки и углы (по R, A и finish) - по ним и работает is_goal
+    bool goal_at_generation;  // проверять цель уже при генерации последователей (см. insert_successors в KC_astar.hpp)
 
     SearchTree *ast;  // указатель на дерево поиска, где будет осуществляться поиск
 
@@ -31,15 +61,29 @@ struct StateLatticeParams {
                   //        в качестве эвристики - octile distance
 
     ControlSet *control_set;  // указатель на используемый control_set
+
+    DeadEnds *dead_ends;  // маска тупиковых состояний (NULL, если не используется, см. KC_deadends.hpp)
+    unordered_set <size_t> dead_goal_reaching;  // номера тупиковых состояний, из которых всё же можно доехать до цели (их не отбрасываем)
+    const uint8_t *area;  // маска клеток (height * width байт), в которых могут заканчиваться примитивы; NULL - вся карта
+                          // (так поиск ограничивается коридором из кластеров, см. KC_hierarchy.hpp)
+    int max_degree;  // наибольшее количество последователей (или предшественников) у одной вершины (ёмкость Successors)
     
 
     StateLatticeParams(Vertex *start, Vertex *finish, Map *map, ControlSet *control_set, bool use_fast_closed = true,
-                       string mode = "PRIM", long double R = 3.0, int A = 1);
+                       string mode = "PRIM", long double R = 3.0, int A = 1, DeadEnds *dead_ends = NULL);
     ptrVertex get_start_vertex();
     bool is_goal(ptrVertex v);
+    bool is_goal_key(StateKey key);
     bool check_prim(int i, int j, Primitive* prim);
-    void get_successors(ptrVertex v, vector <pair <ptrVertex, long double>> &list);
+    void collect_dead_goals();
+    bool set_finish(Vertex *finish);
+    long double edge_cost(Primitive *prim);
+    void get_successors(ptrVertex v, Successors &list);
+    void get_predecessors(ptrVertex v, Successors &list);
+    ptrVertex new_vertex(StateKey key, int info);
+    void get_affected(int i, int j, vector <pair <Vertex, Vertex>> &edges);
     long double heuristic(ptrVertex v);
+    void heuristic_batch(const int *i, const int *j, int n, long double *h);
 };
 
 
@@ -61,12 +105,27 @@ struct TypesGraphParams {
 
     SearchTree *ast;  
     TypeInfo *type_info;  // указатель на используемый набор типов
+    uint32_t goal_window;  // битовая маска углов, которые (с точки зрения меры A) подходят к finish->theta
+    GoalRegion goal_region;
+    bool goal_at_generation;
+    int max_degree;
     
 
     TypesGraphParams(Vertex *start, Vertex *finish, Map *map, TypeInfo *type_info, bool use_fast_closed = true,
                     long double R = 3.0, int A = 1);
     ptrVertex get_start_vertex();
+    bool set_finish(Vertex *finish);
     bool is_goal(ptrVertex v);
-    void get_successors(ptrVertex v, vector <pair <ptrVertex, long double>> &list);
+    bool is_goal_key(StateKey key);
+    void get_successors(ptrVertex v, Successors &list);
+    void get_predecessors(ptrVertex v, Successors &list);
+    ptrVertex new_vertex(StateKey key, int info);
+    void get_affected(int i, int j, vector <pair <Vertex, Vertex>> &edges);
     long double heuristic(ptrVertex v);
+    void heuristic_batch(const int *i, const int *j, int n, long double *h);
 };
+
+
+
+
+bool may_reach(Map *map, Vertex *start, Vertex *finish, long double R);  // быстрая проверка, что путь вообще может существовать
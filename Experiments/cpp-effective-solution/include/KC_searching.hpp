@@ -2,30 +2,74 @@
 
 #include <vector>
 #include <queue>
+#include <algorithm>
 #include <unordered_set>
+#include <cstdint>
 
 #include "KC_heap.hpp"
 #include "KC_structs.hpp"
+#include "KC_stats.hpp"
+#include "KC_mmap.hpp"
 
 using namespace std;
 
 
 
 
+struct CellUpdate {
+    /*
+    Изменение одной клетки карты (см. Map::set_cells): клетка (i, j) становится занятой (occupied = 1) или свободной.
+    */
+
+    int i, j;
+    bool occupied;
+};
+
+
 struct Map {
     /*
     Данная структура описывает карту (дискретное рабочее пространство), на которой
     будет производиться поиск.
+
+    Клетки хранятся в виде плоской битовой матрицы: ряд i занимает row_words 64-битных слов, j-ый бит ряда равен 1,
+    если клетка (i,j) занята, и 0, если свободна (в ней может находиться агент). Кроме того, для каждой клетки
+    хранится clearance - расстояние (в смысле max(|di|, |dj|)) до ближайшей занятой клетки или края карты, и номер
+    компоненты связности (свободные клетки, соседние по стороне или углу, лежат в одной компоненте).
+
+    После первого чтения карты рядом с файлом карты сохраняется бинарный кэш (файл с окончанием .kcache), который
+    при следующих загрузках отображается в память, а не разбирается заново (см. read_file_to_cells).
+    После загрузки карту можно менять (см. set_cells): тогда массивы копируются в память процесса и меняются только
+    в ней - ни файл карты, ни его кэш не трогаются.
     */
 
-    vector <vector <bool>> cells;  // это двумерная булева матрица, где элемент на позиции (i,j) равен 1, если соответствующая
-                                   // клетка рабочего пространства занята и 0, если свободна (в ней может находиться агент).
     int width, height;  // размеры карты: ширина и высота
+    int row_words;  // сколько 64-битных слов занимает один ряд клеток
+    const uint64_t *cells;  // битовая матрица занятости (height * row_words слов)
+    const uint16_t *clearance;  // матрица height * width расстояний до ближайшего препятствия
+    const int *component;  // матрица height * width номеров компонент связности (-1 у занятых клеток)
+    int components_amount;  // количество компонент связности
 
     Map();
     void read_file_to_cells(string file_map, bool obs=true);
     bool in_bounds(int i, int j);
     bool traversable(int i, int j);
+    int get_clearance(int i, int j);
+    int get_component(int i, int j);
+    vector <pair <int, int>> set_cells(const vector <CellUpdate> &updates);
+
+private:
+    vector <uint64_t> own_cells;  // массивы, если карта прочитана из текстового файла (или изменена после загрузки)
+    vector <uint16_t> own_clearance;
+    vector <int> own_component;
+    MappedFile mapped;  // отображённый в память кэш (если карта загружена из него)
+    bool components_valid;  // 0, если карта изменилась, а компоненты связности ещё не пересчитаны
+
+    void parse_text(string file, bool obs);
+    void calc_clearance();
+    void block_clearance(int i, int j);
+    void calc_components();
+    bool load_cache(string file);
+    void save_cache(string file);
 };
 
 
@@ -79,6 +123,19 @@ struct VertexEqual {
 
 
 
+struct OpenList : public priority_queue <ptrSearchNode, vector <ptrSearchNode>, NodeCompare> {
+    /*
+    Список OPEN - обычная очередь с приоритетами, у которой дополнительно открыт доступ к её массиву: это нужно, чтобы
+    при смене эвристики пересчитать f-значения всех вершин и заново упорядочить очередь (см. SearchTree::reorder_open).
+    */
+
+    vector <ptrSearchNode> &nodes() { return c; }
+    void reorder() { make_heap(c.begin(), c.end(), comp); }
+};
+
+
+
+
 struct SearchTree {
     bool use_fast_closed;  // использовать ли fast_closed (если False, то в качестве CLOSED будет обычный set_closed в виде хеш-множества) 
 
@@ -88,7 +145,8 @@ struct SearchTree {
     // обычный std::vector подойдёт) и структуру, в которой описана функция сравнения двух элементов этой очереди (здесь
     // как раз нужна описанная ранее структура NodeCompare))
     // (подробнее: https://stackoverflow.com/questions/20826078/priority-queue-comparison)
-    priority_queue <ptrSearchNode, vector <ptrSearchNode>, NodeCompare> open;
+    // (в OpenList эта очередь дополнительно умеет пересчитывать порядок, если f-значения изменились)
+    OpenList open;
     
     // в качестве списка CLOSED можно использовать хеш-множество - std::unordered_set;
     // для этого указываем, что она будет хранить (ptrVertex - как бы указатель на Vertex) и две структуры с функцией
@@ -101,6 +159,8 @@ struct SearchTree {
     // именно биты, а не True/False из bool, так как bool занимает 1 байт = 8 битов -> больше памяти...).
     // (вообще такой CLOSED должен быть гораздо быстрее, так как одно дело при вставке нового элемента в CLOSED
     // изменить один бит, а другое - взять хеш, вставить в хеш-таблицу и тд...)
+    int closed_height, closed_width, closed_info;  // размеры fast_closed: бит есть у каждой вершины с 0 <= i < closed_height,
+                                                   // 0 <= j < closed_width, 0 <= theta (= info) < closed_info
     vector <uint8_t> fast_closed;  // в C++ uint8_t - это тип данных всегда равный 1 байту = 8 битов -> вектор из них
                                    // можно рассматривать как набор битов (если вектор длины N, то это набор из 8*N бит)
 
@@ -110,12 +170,23 @@ struct SearchTree {
     // должны быть ещё не удалены!):
     vector <ptrSearchNode> expanded_nodes;
 
+    SearchStats stats;  // статистика поиска в этом дереве (заполняется, только если объявлен SEARCH_STATS)
 
-    SearchTree(bool fast);
+
+    SearchTree(bool fast, int height, int width, int info_amount);
     bool open_is_empty();
     void add_to_open(ptrSearchNode item);
     void add_to_closed(ptrSearchNode item);
     bool was_expanded(ptrVertex item);
+    bool was_expanded(int i, int j, int info);
+    void prefetch_closed(int i, int j, int info);
     ptrSearchNode get_best_node_from_open();
+    void reorder_open();
+    size_t nodes_amount();
+    size_t memory_bytes();
+    static size_t node_bytes();
     ~SearchTree();
+
+private:
+    size_t index_in_closed(int i, int j, int info);
 };
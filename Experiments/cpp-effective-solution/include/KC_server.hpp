@@ -0,0 +1,141 @@
+/*
+Данный файл описывает режим сервера запросов: test_astar один раз загружает набор карт, control set и типов (реестр),
+а затем отвечает на запросы поиска пути, пока его не остановят. Так при каждом запросе не тратится время на чтение и
+разбор файлов - время ответа определяется только самим поиском.
+
+Запуск:
+    ./test_astar serve <файл реестра> [путь к Unix-сокету] [количество потоков] [размер сохранённых деревьев]
+Если путь к сокету не указан (или указан "-"), то запросы читаются из stdin, а ответы пишутся в stdout; иначе сервер
+слушает Unix-сокет, и каждое подключение может присылать свои запросы. Запросы обрабатываются параллельно пулом потоков
+(по умолчанию - по числу ядер), поэтому ответы могут приходить не в том порядке, в котором пришли запросы.
+
+Файл реестра - по строке на файл (пустые строки и строки, начинающиеся с #, пропускаются):
+    map <имя> <файл карты>
+    control_set <имя> <файл control set>
+    types <имя> <файл типов>
+    hierarchy <имя карты> <имя control set>
+Для каждой пары (карта, control set) сразу загружается (или считается) маска тупиков (см. KC_deadends.hpp), а для пар,
+перечисленных в строках hierarchy, - ещё и иерархическая абстракция карты (см. KC_hierarchy.hpp).
+
+Запрос - одна строка:
+    <id> <карта> <набор> <алгоритм> <si> <sj> <stheta> <gi> <gj> <gtheta> [R] [A] [время в мс]
+где набор - имя control set и/или типов из реестра, алгоритм - PRIM, COST, TYPES, PARALL_<T> (например, PARALL_20) или
+HPA (поиск по иерархической абстракции, стоимость - как в COST; только для одной цели),
+R и A задают целевые состояния (по умолчанию 3 и 1), а время - ограничение на время поиска (0 - без ограничения).
+Вместо одной цели можно указать сразу несколько: "goals <n> <gi> <gj> <gtheta> ..." (n троек) - тогда пути до всех
+них ищутся одним деревом поиска (см. AstarSearchMany, кроме PARALL), а на каждую цель приходит своя строка ответа с
+номером <id>.<k> (k - номер цели, начиная с 0). Путь до каждой цели при этом может немного отличаться (по стоимости - в
+пределах неточности эвристики) от пути, найденного отдельным запросом до этой же цели.
+Запрос до одной цели (кроме PARALL) продолжает дерево поиска, сохранённое потоком после прошлого запроса из того же
+старта с теми же настройками (см. KC_reuse.hpp). Сколько вершин поиска могут занимать сохранённые деревья каждого потока
+(вместе с памятью, которую каждое дерево занимает независимо от количества вершин, - в пересчёте на вершины), задаёт
+последний параметр запуска (по умолчанию MAX_KEPT_NODES из common.hpp, 0 - не сохранять деревья).
+
+Ответ - тоже одна строка:
+    <id> found <стоимость> <шаги> <время в мс> <lattice|types> <n> <i j theta_или_тип> ... (n троек - путь от старта)
+    <id> not_found|rejected|timeout -1 <шаги> <время в мс>
+    <id> error <сообщение>
+Путь на state lattice - это дискретные состояния (i, j, theta), а на графе типов - целевые типовые ячейки (i, j, type),
+как и в make_path. rejected означает, что старт и финиш лежат в разных компонентах связности карты.
+*/
+
+#pragma once
+
+#include <string>
+#include <map>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "KC_searching.hpp"
+#include "KC_structs.hpp"
+#include "KC_deadends.hpp"
+#include "KC_hierarchy.hpp"
+#include "KC_reuse.hpp"
+#include "common.hpp"
+
+using namespace std;
+
+
+
+
+struct AssetRegistry {
+    /*
+    Данная структура хранит все загруженные сервером карты, control set и типы (по именам из файла реестра), а также
+    маски тупиков для каждой пары (карта, control set). После загрузки всё это только читается, поэтому одни и те же
+    данные одновременно используются всеми потоками без блокировок.
+    */
+
+    map <string, Map*> maps;
+    map <string, ControlSet*> control_sets;
+    map <string, TypeInfo*> types;
+    map <pair <string, string>, DeadEnds*> dead_ends;  // по (имя карты, имя control set)
+    map <pair <string, string>, Hierarchy*> hierarchies;  // тоже по (имя карты, имя control set), только перечисленные в реестре
+
+    void load(string file);
+    ~AssetRegistry();
+};
+
+
+struct WorkerCaches {
+    /*
+    Деревья поиска, которые поток пула сохраняет между запросами (см. KC_reuse.hpp): отдельно для state lattice и
+    для графа типов.
+    */
+
+    SearchTreeCache <StateLatticeParams> lattice;
+    SearchTreeCache <TypesGraphParams> types;
+
+    WorkerCaches(size_t max_nodes) : lattice(max_nodes), types(max_nodes) {}
+};
+
+
+string answer_query(AssetRegistry &registry, string line, WorkerCaches *caches = NULL);  // обрабатывает один запрос и возвращает строку ответа (без '\n')
+
+
+
+
+struct QueryClient {
+    /*
+    Данная структура описывает того, кто прислал запросы (stdout или подключение к сокету): ответы пишутся в файловый
+    дескриптор fd целыми строками (под блокировкой, чтобы ответы разных потоков не перемешивались).
+    Дескриптор закрывается, когда на все запросы клиента ответили и он больше не нужен (если close_fd = 1).
+    */
+
+    int fd;
+    bool close_fd;
+    mutex write_lock;
+
+    QueryClient(int fd, bool close_fd);
+    void reply(const string &line);
+    ~QueryClient();
+};
+
+
+struct QueryServer {
+    /*
+    Данная структура описывает пул потоков, отвечающих на запросы: запросы складываются в очередь queue, а каждый
+    поток пула забирает их оттуда по одному. У каждого потока своя куча HEAP (она не потокобезопасна).
+    */
+
+    AssetRegistry *registry;
+    size_t kept_nodes;  // ограничение памяти на сохранённые деревья поиска каждого потока
+
+    deque <pair <string, shared_ptr <QueryClient>>> queue;  // ещё не обработанные запросы и от кого они
+    bool finished;  // новых запросов больше не будет (потоки доделывают очередь и выходят)
+    mutex lock;  // защищает queue и finished
+    condition_variable has_work;
+    vector <thread> workers;
+
+    QueryServer(AssetRegistry *registry, int threads, size_t kept_nodes);
+    void submit(string line, shared_ptr <QueryClient> client);
+    void close();
+    ~QueryServer();
+
+    void worker_loop();
+};
+
+
+int run_server(string registry_file, string socket_path, int threads, size_t kept_nodes = MAX_KEPT_NODES);
@@ -0,0 +1,59 @@
+/*
+Данный файл описывает пакетное вычисление эвристик для последователей раскрываемой вершины.
+
+При раскрытии get_successors выдаёт сразу десятки последователей, и эвристика для каждого считается отдельным
+вызовом p->heuristic(u) в long double. С SIMD_HEURISTIC последователи сначала раскладываются в массивы (SoA: отдельно
+i, отдельно j - SuccessorBatch, координаты берутся прямо из ключей Successors), и эвристики для них считаются одним
+вызовом p->heuristic_batch, а уже потом вершины добавляются в OPEN (см. insert_successors в KC_astar.hpp).
+
+Сами формулы (евклидово расстояние и octile distance) зависят только от сдвигов до финиша, поэтому легко
+векторизуются: ядра ниже считают их в double по 8 (AVX-512) или по 4 (AVX2 + FMA) вершины за раз; если процессор
+(точнее, флаги компиляции) этого не поддерживает, то работает скалярный вариант с теми же самыми операциями. Ядра
+дают результат, побитово совпадающий со скалярным: сдвиги - целые числа, так что все операции, кроме корня и
+умножения на sqrt(2), точны, корень в обоих вариантах правильно округляется, а умножение со сложением в octile
+distance и там, и там делается одной операцией fma. Если объявить SIMD_CHECK (common.hpp), то каждый пакет
+дополнительно пересчитывается скалярно и сравнивается побитово (а bench_astar проверяет это всегда).
+
+Но long double в векторные регистры не помещается, а эвристика в double отличается от прежней в последних знаках -
+и при равных f-значениях A* может раскрывать вершины в другом порядке (и находить другой путь той же природы, например,
+в другую целевую клетку). Поэтому пакеты и double-ядра используются в поиске, только если объявлен SIMD_HEURISTIC (и
+тогда p->heuristic(u) для стартовой вершины тоже считается ядром - эвристика во всём поиске одна и та же). Без него
+эвристика последователей считается по одной вершине p->heuristic(u), как раньше: пакетный цикл в long double с
+-ffast-math компилятор округляет иначе, чем f = g + p->heuristic(u) (и на части тестов это меняет пути и даже то,
+найден ли путь за отведённые шаги), поэтому heuristic_batch без SIMD_HEURISTIC в поиске не используется.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "KC_heap.hpp"
+#include "KC_structs.hpp"
+#include "common.hpp"
+
+using namespace std;
+
+
+
+
+struct SuccessorBatch {
+    /*
+    Данная структура хранит координаты последователей раскрываемой вершины в виде отдельных массивов (чтобы их
+    можно было загружать в векторные регистры) и посчитанные для них эвристики. Память не освобождается между
+    раскрытиями, так что после первых раскрытий выделений памяти нет.
+    */
+
+    vector <int> i, j;
+    vector <long double> h;
+
+    void resize(size_t n);
+    void gather(const Successors &succ_list);
+};
+
+
+
+
+void euclid_batch(const int *i, const int *j, int n, int goal_i, int goal_j, double *h);
+void octile_batch(const int *i, const int *j, int n, int goal_i, int goal_j, double *h);
+void euclid_batch_scalar(const int *i, const int *j, int n, int goal_i, int goal_j, double *h);
+void octile_batch_scalar(const int *i, const int *j, int n, int goal_i, int goal_j, double *h);
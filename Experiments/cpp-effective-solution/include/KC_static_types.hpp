@@ -0,0 +1,74 @@
+/*
+Данный файл описывает вариант настроек поиска на графе типов, в котором таблица переходов вкомпилирована в программу.
+
+Граф типов фиксирован для каждого файла с типами, но TypesGraphParams::get_successors узнаёт это только во время
+работы: для каждой ячейки читает через указатели type_info границы соседей её типа (CSR), а затем самих соседей.
+Программа compile_data умеет генерировать по файлу с типами заголовочный файл (KC_types_main.hpp и т.д., make
+generated_types), в котором та же таблица записана constexpr-массивами: соседи каждого типа дополнены до max_degree
+(у всех нынешних наборов это 3), поэтому цикл по ним имеет постоянную границу и разворачивается компилятором, а
+таблица лежит по известному при компиляции адресу и читается одной строкой кэша на тип. Стоимость перехода не
+хранится - она определяется сдвигом (1 по стороне, Table::diagonal_cost по углу).
+(Вариант со switch по типу, где соседи каждого типа вписаны в код константами, оказался медленнее: переход по
+таблице switch при случайных типах ячеек плохо предсказывается.)
+
+Всё остальное (эвристика, дерево поиска, восстановление пути) берётся от TypesGraphParams, поэтому для поиска нужны
+и загруженные типы: конструктор сверяет их контрольную сумму с таблицей (если файл с типами изменился, а таблица не
+перегенерирована, то это ошибка). Результаты поиска те же, что у TypesGraphParams с этими типами.
+*/
+
+#pragma once
+
+#include <string>
+#include <stdexcept>
+
+#include "KC_astar.hpp"
+#include "KC_structs.hpp"
+#include "common.hpp"
+
+using namespace std;
+
+
+
+
+template <typename Table>
+struct StaticTypesGraphParams: TypesGraphParams {
+    /*
+    Данная структура - настройки поиска на графе типов со сгенерированной таблицей Table (см. начало файла).
+    */
+
+    StaticTypesGraphParams(Vertex *start, Vertex *finish, Map *map, TypeInfo *type_info, bool use_fast_closed = true,
+                           long double R = 3.0, int A = 1): TypesGraphParams(start, finish, map, type_info, use_fast_closed, R, A) {
+        if (type_info->checksum() != Table::checksum)
+            throw runtime_error(string("Загруженные типы не совпадают с таблицей, сгенерированной по ") + Table::file +
+                                " (перегенерируйте её: make generated_types)!");
+    }
+
+
+    bool is_goal(ptrVertex v) {
+        return (goal_region.at(v->i, v->j) & Table::goal_mask_by_type[v->type]) != 0;
+    }
+
+
+    bool is_goal_key(StateKey key) {
+        return (goal_region.at(state_i(key), state_j(key)) & Table::goal_mask_by_type[state_code(key)]) != 0;
+    }
+
+
+    void get_successors(ptrVertex v, Successors &list) {
+        /*
+        Данная функция делает то же, что TypesGraphParams::get_successors, но по сгенерированной таблице.
+        */
+
+        static constexpr long double cost[2] = {1, Table::diagonal_cost};  // (без ветвления: сдвиг по углу - индекс 1)
+        const typename Table::Step *steps = Table::succ[v->type];
+        int degree = Table::degree_by_type[v->type];
+        for (int k = 0; k < Table::max_degree; k ++) {  // (граница - константа -> цикл разворачивается)
+            if (k == degree)
+                break;
+            int i = v->i + steps[k].di, j = v->j + steps[k].dj;
+            STATS(ast->stats.collision_cells += 1);
+            if (task_map->in_bounds(i, j) && task_map->traversable(i, j))
+                list.push(pack_state(i, j, steps[k].type), steps[k].info, cost[(steps[k].di != 0) & (steps[k].dj != 0)]);
+        }
+    }
+};
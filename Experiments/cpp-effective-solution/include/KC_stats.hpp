@@ -0,0 +1,41 @@
+/*
+Данный файл описывает сбор подробной статистики работы алгоритма A* (сколько вершин сгенерировано, раскрыто,
+сколько дубликатов выкинуто и тд). Эти числа позволяют понять, на что именно тратится время поиска на каждой карте.
+
+Сбор статистики включается объявлением переменной SEARCH_STATS в файле common.hpp. Если она не объявлена, то
+макрос STATS заменяется на пустую строку (аналогично rassert), поэтому никакого замедления в обычной сборке нет.
+*/
+
+#pragma once
+
+#include "common.hpp"
+
+using namespace std;
+
+#ifdef SEARCH_STATS
+    #define STATS(code) { code; }  // код внутри STATS выполняется только при сборе статистики
+#else
+    #define STATS(code) (void) 1;
+#endif
+
+
+
+
+struct SearchStats {
+    /*
+    Данная структура хранит счётчики одного поиска (одного запуска A*).
+    */
+
+    long long generated;  // сколько всего сгенерировано последователей (в get_successors)
+    long long expanded;  // сколько вершин раскрыто
+    long long duplicates;  // сколько дубликатов извлечено из OPEN (и выкинуто) в get_best_node_from_open
+    long long pruned_closed;  // сколько сгенерированных последователей отброшено, так как они уже в CLOSED (was_expanded)
+    long long pruned_dead_ends;  // сколько последователей не сгенерировано, так как они в тупиковых состояниях (KC_deadends.hpp)
+    long long peak_open;  // максимальный размер OPEN за время поиска
+    long long peak_pool;  // максимальное количество одновременно используемых SearchNode в рукописной куче MyHEAP
+    long long check_prim_calls;  // сколько раз вызывалась проверка примитива на коллизии (check_prim)
+    long long collision_cells;  // сколько всего клеток карты проверено на препятствия
+
+    SearchStats();
+    void merge(const SearchStats &other);
+};
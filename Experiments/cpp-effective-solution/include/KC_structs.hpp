@@ -3,11 +3,21 @@
 #include <vector>
 #include <string>
 #include <tuple>
+#include <cstdint>
 
 #include "KC_heap.hpp"
+#include "KC_mmap.hpp"
+#include "common.hpp"
+#include "rassert.hpp"
 
 struct Primitive;
 
+#ifdef TRAJECTORY_FLOAT32
+typedef float traj_coord;  // тип координат точек траекторий примитивов
+#else
+typedef _Float16 traj_coord;  // (половинной точности хватает: примитивы отходят от начала на единицы клеток, погрешность - сотые доли клетки)
+#endif
+
 using namespace std;
 
 
@@ -46,6 +56,49 @@ struct Vertex {
 
 
 
+
+typedef uint64_t StateKey;  // вершина, упакованная в одно число: i и j (по 22 бита), угол (у дискретного состояния) или тип (у типовой ячейки) - 20 бит
+
+static inline StateKey pack_state(int i, int j, int code) {
+    return ((uint64_t) i << 42) | ((uint64_t) j << 20) | (uint64_t) code;
+}
+static inline int state_i(StateKey key) { return key >> 42; }
+static inline int state_j(StateKey key) { return (key >> 20) & ((1 << 22) - 1); }
+static inline int state_code(StateKey key) { return key & ((1 << 20) - 1); }
+
+
+
+
+struct Successors {
+    /*
+    Данная структура - буфер последователей (или предшественников) одной вершины графа: k-ый последователь - это
+    вершина key[k] (упакованная, см. StateKey), её информация для склеивания info[k] (у дискретного состояния - угол)
+    и стоимость перехода в неё cost[k]. Вершины в куче HEAP при генерации не создаются: поиск проверяет CLOSED прямо
+    по ключу и создаёт вершину, только если кладёт её в OPEN.
+    Ёмкость буфера задаётся один раз (максимальная степень вершины графа, см. max_degree у настроек поиска), и
+    дальше он переиспользуется без выделения памяти.
+    */
+
+    int size, capacity;
+    vector <StateKey> key;
+    vector <int> info;
+    vector <long double> cost;
+
+    Successors();
+    void reserve(int capacity);
+    void clear() { size = 0; }
+    void push(StateKey key, int info, long double cost) {
+        rassert(size < capacity, "Последователей больше, чем ёмкость буфера!");
+        this->key[size] = key;
+        this->info[size] = info;
+        this->cost[size] = cost;
+        size += 1;
+    }
+};
+
+
+
+
 struct Primitive {
     /*
     Данная структура предназначена для хранения уже сгенерированного примитива control set.
@@ -53,20 +106,28 @@ struct Primitive {
     (дискретным направлением), под которым выходят, а также целевым состоянием. Заметим, что для описания
     целевого состояния используется экземпляр Vertex, так как он в коде играет роль и типовой ячейки, и
     дискретного состояния одновременно (отличаются они используемыми полями внутри Vertex).
+
+    Сами клетки коллизионного следа примитив не хранит: он лишь указывает на свой кусок общих массивов
+    ControlSet (которые либо загружены из текстового файла, либо лежат прямо в отображённом в память бинарном файле).
+    Причём это может быть след другого примитива, симметричного данному (см. ControlSet): тогда k-ая клетка следа
+    данного примитива - это (coll_sign_i * collision_in_i[k], coll_sign_j * collision_in_j[k]).
     */
 
     int start_theta;  // начальный угол (= номер дискретного направления), из которого стартует примитив (координаты начала всегда = 0,0)
-    ptrVertex goal;  // целевое состояние, куда ведет примитив
-    vector <int> collision_in_i;  // два вектора, которые содержат координаты i и j клеток коллизионного следа примитива
-    vector <int> collision_in_j;
+    Vertex goal;  // целевое состояние, куда ведет примитив
+    const int *collision_in_i;  // два массива, которые содержат координаты i и j клеток коллизионного следа примитива
+    const int *collision_in_j;  // (с точностью до знаков coll_sign_i, coll_sign_j)
+    int coll_sign_i, coll_sign_j;  // +1 или -1
+    int collision_size;  // количество клеток в коллизионном следе
+    const traj_coord *traj_in_i;  // точки траектории (самой кривой) примитива в координатах (i, j) - с точностью до тех же
+    const traj_coord *traj_in_j;  // знаков coll_sign_i, coll_sign_j (и обмена массивов), что и у коллизионного следа
+    int traj_size;  // количество точек траектории
+    int reach;  // максимальное значение max(|i|, |j|) по клеткам коллизионного следа (насколько далеко след отходит от начала)
     long double length;  // длина примитива
     long double collision_cost;  // стоимость его коллизионного следа
     int turning;  // на сколько примитив поворачивает
 
     Primitive();
-    void add_collision(int i, int j);
-    void calc_collision();
-    ~Primitive();
 };
 
 
@@ -75,15 +136,91 @@ struct Primitive {
 struct ControlSet {
     /*
     Данная структура описывает набор примитивов control set.
+
+    Все данные примитивов хранятся в виде плоских массивов (SoA - structure of arrays): k-ый элемент каждого массива
+    относится к k-му примитиву, а примитивы упорядочены по стартовому углу (heading_begin[theta] - номер первого
+    примитива с углом theta). Коллизионный след k-го примитива - это клетки с номерами от coll_begin[k] до
+    coll_begin[k+1]-1 в массивах coll_i, coll_j.
+
+    Почти все примитивы являются поворотами и отражениями примитивов нескольких первых углов (для 16 углов - углов
+    0, 1 и 2): сетка переходит в себя при 8 преобразованиях (поворотах на 90 градусов и отражениях). Поэтому
+    коллизионные следы хранятся только у "канонических" примитивов, а у остальных след пустой, а coll_source[k] - номер
+    канонического примитива, чей след нужно взять, и coll_transform[k] - преобразование, которое переводит тот след
+    в след k-го примитива (см. transform_cell в KC_structs.cpp). Для канонических примитивов coll_source[k] = k,
+    coll_transform[k] = 0. Примитив считается симметричным, только если преобразованный примитив совпадает с ним в
+    точности (цель, длина, поворот и все клетки следа в том же порядке), иначе его след просто хранится целиком.
+    Точки траекторий примитивов (в текстовом файле - "trajectory is:") хранятся так же: только у канонических
+    примитивов, в общих массивах traj_i, traj_j (точки k-го примитива - с номерами от traj_begin[k] до traj_begin[k+1]-1),
+    в половинной точности (или в float, см. TRAJECTORY_FLOAT32). Для поиска они не нужны - только для вывода траектории.
+    Такой набор массивов можно либо построить при чтении текстового файла (тогда они хранятся в векторах owned_*),
+    либо без всякого копирования взять прямо из отображённого в память скомпилированного бинарного файла (см. save_binary).
     */
 
-    int theta_amount;
+    int theta_amount;  // количество дискретных направлений (определяется при загрузке по самому файлу)
+    int prims_amount;  // общее количество примитивов
+    long long cells_amount;  // суммарное количество клеток во всех хранимых (канонических) коллизионных следах
+    long long points_amount;  // суммарное количество точек во всех хранимых траекториях
+
+    const int *heading_begin;  // theta_amount+1 чисел
+    const int *start_theta;
+    const int *goal_i;
+    const int *goal_j;
+    const int *goal_theta;
+    const int *turning;
+    const long double *length;
+    const long double *collision_cost;
+    const int *coll_begin;  // prims_amount+1 чисел
+    const int *coll_source;
+    const int *coll_transform;
+    const int *coll_i;
+    const int *coll_j;
+    const int *traj_begin;  // prims_amount+1 чисел
+    const traj_coord *traj_i;
+    const traj_coord *traj_j;
+
     vector <vector <Primitive*>> control_set;  // тут для каждого номера i дискретного направления хранится список выходящих под этим направлением примитивов
+    vector <vector <Primitive*>> control_set_by_goal;  // а тут - список примитивов, заканчивающихся под этим направлением (для обратных обходов)
 
     ControlSet();
     void load_primitives(string file);
+    void save_binary(string file);
+    static bool compiled_from(string binary_file, string source_file);
+    uint64_t checksum();
     vector <Primitive*> &get_prims_by_heading(int heading);
+    vector <Primitive*> &get_prims_by_goal_heading(int heading);
     ~ControlSet();
+
+private:
+    // массивы, если примитивы загружены из текстового файла:
+    vector <int> own_heading_begin, own_start_theta, own_goal_i, own_goal_j, own_goal_theta, own_turning;
+    vector <long double> own_length, own_collision_cost;
+    vector <int> own_coll_begin, own_coll_source, own_coll_transform, own_coll_i, own_coll_j;
+    vector <int> own_traj_begin;
+    vector <traj_coord> own_traj_i, own_traj_j;
+    MappedFile mapped;  // отображённый в память бинарный файл (если примитивы загружены из него)
+    uint64_t source_size;  // размер и время изменения текстового файла, из которого загружены примитивы (пишутся в
+    int64_t source_mtime;  // скомпилированный файл, чтобы замечать, что он устарел; см. compiled_from)
+    vector <Primitive> primitives;  // сами примитивы (указывают на куски массивов выше)
+
+    void load_text(string file);
+    void load_binary(string file);
+    void build_primitives();
+};
+
+
+
+
+struct TypeSuccessor {
+    /*
+    Данная структура описывает одного соседа типовой ячейки в графе типов: сдвиг (di, dj) в соседа, его тип,
+    информация для склеивания (заранее взятая из add_info_by_type, чтобы не искать её при каждой генерации)
+    и стоимость перехода в него (1 по стороне клетки, корень из 2 по углу).
+    */
+
+    int di, dj;
+    int type;
+    int info;
+    long double cost;
 };
 
 
@@ -93,29 +230,70 @@ struct TypeInfo {
     /*
     Данная структура описывает всю необходимую информацию, связанную
     с номерами конфигураций (= типами).
+
+    Аналогично ControlSet, все данные хранятся в плоских массивах, которые либо строятся при чтении текстового
+    файла, либо берутся прямо из отображённого в память скомпилированного бинарного файла (см. save_binary).
+    Во всех массивах, индексируемых типом, ровно types_amount элементов.
     */
 
-    // вектор, в котором по типу type получаем список соседей ячеек этого типа в виде троек (di, dj, t):
-    // (di, dj - сдвиг в этого соседа из текущей ячейки, t - тип соседа)
-    vector <vector <tuple <int, int, int>>> successors;  
+    int theta_amount;  // количество дискретных направлений (определяется при загрузке по самому файлу)
+    int types_amount;  // количество типов (все типы от 0 до types_amount-1)
+    int info_amount;  // количество различных значений информации для склеивания
+    long long succ_amount;  // суммарное количество соседей у всех типов
+
+    // соседи типовых ячеек в формате CSR: соседи ячейки типа type - это succ[succ_begin[type]], ..., succ[succ_begin[type+1]-1]
+    // (di, dj - сдвиг в этого соседа из текущей ячейки, type - тип соседа)
+    const int *succ_begin;  // types_amount+1 чисел
+    const TypeSuccessor *succ;
+
+    // предшественники в том же формате (для обратных обходов): предшественники ячейки типа type - это pred[pred_begin[type]], ...,
+    // pred[pred_begin[type+1]-1] (di, dj - сдвиг из текущей ячейки в предшественника, type и info - его тип и информация,
+    // cost - стоимость перехода из него в текущую ячейку); строятся при загрузке по succ и в бинарном файле не хранятся
+    const int *pred_begin;
+    const TypeSuccessor *pred;
 
     // по номеру дискретного направления theta получаем тип начальной ячейки, в конфигурации
     // которой начинаются примитивы в этом угле:
-    vector <int> start_type_by_theta;  
+    const int *start_type_by_theta;  
 
-    // по типу type и номеру дискретного направления theta получаем, является ли ячейка этого типа целевой,
-    // то есть заканчивается ли в ней примитив под углом theta:
-    vector <vector <bool>> is_goal_by_theta_type;
+    // по типу type получаем битовую маску углов: theta-ый бит равен 1, если в ячейке этого типа заканчивается
+    // примитив под углом theta (так проверка, является ли ячейка целевой, делается одной операцией AND):
+    const uint32_t *goal_mask_by_type;
 
-    // по предыдущему списку может быть долго проверять, является ли ячейка целевой -> вводим ещё один список:
+    // по goal_mask_by_type может быть неудобно узнавать финальный угол -> вводим ещё один список:
     // по типу type он будет выдавать номер дискретного угла (если в ячейке этого типа ВСЕ заканчивающиеся примитивы имеют
     // такой финальный угол), -1 (если эта ячейка вообще не целевая, в ней примитивы не кончаются), -2 (если в этой
-    // ячейке заканчиваются примитивы под разными углами - и вот тогда понадобится предыдущий двумерный список)
-    vector <int> goal_theta_by_type;  
+    // ячейке заканчиваются примитивы под разными углами - и вот тогда понадобится маска)
+    const int *goal_theta_by_type;  
 
     // по типу type -> получаем доп. информацию (в виде числа int), с помощью которой можно склеивать вершины:
-    vector <int> add_info_by_type;  
+    const int *add_info_by_type;  
+
+    // при загрузке эквивалентные типы объединяются (см. minimize), поэтому номера типов не совпадают с номерами в
+    // файле: по типу type получаем наименьший номер в файле среди объединённых в него типов (так пути выводятся в
+    // номерах файла), а file_types_amount - сколько типов было в файле:
+    const int *file_type_by_type;
+    int file_types_amount;
 
     TypeInfo();
     void load_types(string file);
+    void save_binary(string file);
+    static bool compiled_from(string binary_file, string source_file);
+    uint64_t checksum();
+
+private:
+    // массивы, если типы загружены из текстового файла:
+    vector <int> own_succ_begin, own_start_type_by_theta, own_goal_theta_by_type, own_add_info_by_type, own_file_type_by_type;
+    vector <TypeSuccessor> own_succ;
+    vector <uint32_t> own_goal_mask_by_type;
+    MappedFile mapped;  // отображённый в память бинарный файл (если типы загружены из него)
+    uint64_t source_size;  // размер и время изменения текстового файла с типами (как у ControlSet)
+    int64_t source_mtime;
+    vector <int> own_pred_begin;  // предшественники (всегда строятся при загрузке)
+    vector <TypeSuccessor> own_pred;
+
+    void load_text(string file);
+    void load_binary(string file);
+    void minimize();
+    void build_predecessors();
 };
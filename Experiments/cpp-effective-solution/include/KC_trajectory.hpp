@@ -0,0 +1,93 @@
+/*
+Данный файл описывает восстановление траектории по пути, найденному на графе типов.
+
+Поиск на графе типов (TypesGraphParams) хранит в parent только целевые ячейки (см. set_parent в KC_astar.hpp), поэтому
+его результат - цепочка целевых ячеек от старта до цели, а не сама траектория. По теореме 3 из диплома траектория
+составляется из примитивов, каждый из которых начинается в одной целевой ячейке цепочки, а заканчивается в одной из
+следующих (примитив может проходить и через другие целевые ячейки, если в них кончаются другие примитивы).
+
+Чтобы не перебирать весь control set, заранее строится индекс PrimitiveIndex: по четвёрке (начальный угол, сдвиг di,
+сдвиг dj, конечный угол) он сразу выдаёт подходящие примитивы. Тогда восстановление - это динамика по парам (номер
+ячейки цепочки, угол): из каждой пары пробуем примитивы в следующие ячейки цепочки, которые лежат не дальше, чем
+длина коллизионного следа самого длинного примитива (через большее количество клеток пути примитив пройти не может).
+Поэтому время восстановления линейно по длине цепочки. Среди допустимых (не задевающих препятствия) вариантов
+выбирается самый дешёвый по стоимости коллизионного следа (как в режиме COST).
+
+Путь на state lattice хранит только дискретные состояния, поэтому и для него примитивы между соседними состояниями
+находятся по тому же индексу (см. lattice_trajectory). По примитивам TrajectoryWriter выводит саму траекторию: точки
+траекторий примитивов (они хранятся один раз на весь control set, см. ControlSet), сдвинутые в начала примитивов и
+склеенные друг с другом, - сразу в поток, без копирования точек.
+*/
+
+#pragma once
+
+#include <vector>
+#include <ostream>
+#include <cstdint>
+#include <unordered_map>
+
+#include "KC_searching.hpp"
+#include "KC_structs.hpp"
+#include "KC_astar.hpp"
+#include "common.hpp"
+
+using namespace std;
+
+
+
+
+struct PrimitiveIndex {
+    /*
+    Данная структура хранит индекс примитивов control set по четвёрке (начальный угол, di, dj, конечный угол).
+    */
+
+    ControlSet *control_set;
+    int max_span;  // максимальный размер коллизионного следа: через сколько клеток пути может пройти один примитив
+
+    PrimitiveIndex(ControlSet *control_set);
+    const vector <Primitive*> *find(int start_theta, int di, int dj, int goal_theta);  // NULL, если таких примитивов нет
+
+private:
+    unordered_map <uint64_t, vector <Primitive*>> index;
+
+    static uint64_t key(int start_theta, int di, int dj, int goal_theta);
+};
+
+
+
+
+struct ResultTrajectory {
+    /*
+    Результат восстановления траектории: states[k] - дискретные состояния от старта до цели, prims[k] - примитив,
+    который ведёт из states[k] в states[k+1] (поэтому примитивов на один меньше, чем состояний).
+    */
+
+    bool found;  // удалось ли составить траекторию из допустимых примитивов
+    long double cost;  // суммарная стоимость рёбер (для графа типов - стоимость коллизионных следов примитивов)
+    vector <Vertex> states;
+    vector <Primitive*> prims;
+};
+
+
+
+
+struct TrajectoryWriter {
+    /*
+    Данная структура выводит точки траектории (по одной "i j" на строку) в поток out по мере добавления примитивов.
+    */
+
+    long long points;  // сколько точек уже выведено
+
+    TrajectoryWriter(ostream &out);
+    void add(const Vertex &from, Primitive *prim);
+    void write(ResultTrajectory &trajectory);
+
+private:
+    ostream &out;
+};
+
+
+
+
+ResultTrajectory reconstruct_trajectory(TypesGraphParams *p, ptrSearchNode final_node, PrimitiveIndex *index);
+ResultTrajectory lattice_trajectory(StateLatticeParams *p, ptrSearchNode final_node, PrimitiveIndex *index);
@@ -0,0 +1,1279 @@
+/*
+Данный файл сгенерирован программой compile_data по data/big_types.txt (make generated_types) - не редактировать вручную.
+Таблица переходов графа типов для StaticTypesGraphParams (см. KC_static_types.hpp).
+*/
+
+#pragma once
+
+#include <cstdint>
+
+
+
+
+struct BigTypes {
+    struct Step {
+        int di, dj;
+        int type;
+        int info;
+    };
+
+    static constexpr const char *file = "data/big_types.txt";
+    static constexpr uint64_t checksum = 16980216609058350004ull;  // TypeInfo::checksum
+    static constexpr int theta_amount = 16;
+    static constexpr int types_amount = 991;
+    static constexpr int max_degree = 3;
+    static constexpr long double diagonal_cost = 1.41421356237000000002L;
+
+    static constexpr int start_type_by_theta[16] = {
+        0, 313, 302, 23, 275, 91, 237, 253, 71, 96, 136, 155, 205, 177, 161, 374
+    };
+    static constexpr uint32_t goal_mask_by_type[991] = {
+        1, 1, 1, 1, 1, 1, 1, 0, 2, 0, 4, 0, 4, 8, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 8, 0, 0, 8, 0, 0,
+        16, 16, 16, 16, 16, 16, 16, 0, 32, 0, 0, 32, 0, 0, 32, 0,
+        0, 16, 16, 16, 16, 16, 0, 32, 0, 0, 0, 64, 64, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 256, 256, 256, 256, 0, 512,
+        0, 0, 512, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0,
+        512, 0, 512, 0, 0, 256, 256, 256, 256, 256, 0, 512, 0, 0, 0, 1024,
+        2048, 0, 0, 2048, 0, 0, 2048, 0, 0, 4096, 4096, 0, 8192, 0, 0, 8192,
+        0, 0, 8192, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2048, 0, 0, 0, 0,
+        0, 16384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 8192, 0, 0, 0, 0, 0, 0, 0, 0, 16384, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 4096, 4096,
+        4096, 4096, 4096, 4096, 0, 2048, 0, 1024, 0, 1024, 512, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0,
+        128, 0, 0, 128, 0, 0, 256, 256, 256, 256, 256, 0, 0, 0, 128, 0,
+        0, 0, 0, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 4,
+        4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 2,
+        0, 0, 1, 1, 1, 1, 1, 0, 2, 0, 0, 0, 0, 0, 4, 8,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 16384, 8192, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 32768, 0, 0, 32768, 0, 0, 32768, 0, 0, 1,
+        1, 1, 1, 1, 0, 0, 0, 32768, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 16384, 8192, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 32768, 0, 0, 0, 0, 0, 0,
+        0, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+        0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 64, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 512, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 64, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 0, 0, 8192,
+        0, 16384, 0, 0, 0, 16384, 32768, 0, 0, 0, 0, 0, 0, 0, 0, 8192,
+        0, 0, 0, 16384, 32768, 0, 2048, 0, 0, 0, 1024, 512, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4096, 4096, 4096, 4096, 4096, 0, 2048, 0, 0, 0, 0, 0, 16384,
+        32768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 4096, 4096, 0, 0,
+        0, 0, 0, 0, 0, 1024, 512, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 128, 0, 0, 0, 0, 0, 0, 1024, 2048, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0, 1024, 2048, 0,
+        0, 0, 0, 0, 0, 0, 0, 128, 0, 64, 0, 64, 32, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0,
+        0, 0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 8, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64,
+        128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 64, 0, 64, 128, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 4,
+        0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 32, 0,
+        0, 0, 0, 0, 0, 0, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 32768, 0, 16384, 0, 16384, 8192, 0, 0, 0, 0, 0, 0, 0
+    };
+    static constexpr int goal_theta_by_type[991] = {
+        0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 2, -1, 2, 3, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, 3, -1, -1, 3, -1, -1,
+        4, 4, 4, 4, 4, 4, 4, -1, 5, -1, -1, 5, -1, -1, 5, -1,
+        -1, 4, 4, 4, 4, 4, -1, 5, -1, -1, -1, 6, 6, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, 8, 8, 8, 8, 8, 8, 8, -1, 9,
+        -1, -1, 9, -1, -1, -1, -1, -1, -1, -1, -1, 5, -1, -1, -1, -1,
+        9, -1, 9, -1, -1, 8, 8, 8, 8, 8, -1, 9, -1, -1, -1, 10,
+        11, -1, -1, 11, -1, -1, 11, -1, -1, 12, 12, -1, 13, -1, -1, 13,
+        -1, -1, 13, -1, -1, -1, -1, -1, 10, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 11, -1, -1, -1, -1,
+        -1, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, 13, -1, -1, -1, -1, -1, -1, -1, -1, 14, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 12, 12, 12,
+        12, 12, 12, 12, -1, 11, -1, 10, -1, 10, 9, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 7, -1, -1,
+        7, -1, -1, 7, -1, -1, 8, 8, 8, 8, 8, -1, -1, -1, 7, -1,
+        -1, -1, -1, 4, 4, 4, 4, 4, -1, -1, -1, -1, -1, -1, -1, 2,
+        2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, 1, -1, -1, 1,
+        -1, -1, 0, 0, 0, 0, 0, -1, 1, -1, -1, -1, -1, -1, 2, 3,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, 14, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, 15, -1, -1, 15, -1, -1, 15, -1, -1, 0,
+        0, 0, 0, 0, -1, -1, -1, 15, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, 14, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, 15, -1, -1, -1, -1, -1, -1,
+        -1, -1, 2, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1,
+        -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, 6, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, 9, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, 6, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 10, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 8, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 12, -1, -1, -1, -1, 13,
+        -1, 14, -1, -1, -1, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, 13,
+        -1, -1, -1, 14, 15, -1, 11, -1, -1, -1, 10, 9, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, 0, -1, -1, -1, -1, -1, -1, -1, 12, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, 12, 12, 12, 12, 12, -1, 11, -1, -1, -1, -1, -1, 14,
+        15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 12, 12, 12, -1, -1,
+        -1, -1, -1, -1, -1, 10, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, 7, -1, -1, -1, -1, -1, -1, 10, 11, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 10, -1, 10, 11, -1,
+        -1, -1, -1, -1, -1, -1, -1, 7, -1, 6, -1, 6, 5, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, -1, -1, -1, -1, -1,
+        -1, -1, 8, -1, -1, -1, -1, -1, -1, -1, -1, 7, -1, 3, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6,
+        7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, 6, -1, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, 2,
+        -1, 2, 1, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, 5, -1,
+        -1, -1, -1, -1, -1, -1, -1, 2, 1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, 15, -1, 14, -1, 14, 13, -1, -1, -1, -1, -1, -1, -1
+    };
+    static constexpr int add_info_by_type[991] = {
+        0, 0, 0, 1, 1, 1, 1, 0, 2, 0, 3, 4, 3, 5, 6, 7,
+        6, 7, 7, 6, 7, 8, 6, 9, 10, 9, 5, 5, 9, 5, 5, 11,
+        12, 13, 12, 14, 14, 14, 14, 12, 15, 16, 17, 15, 15, 17, 15, 15,
+        18, 12, 19, 12, 14, 14, 12, 15, 12, 20, 13, 21, 21, 22, 23, 22,
+        23, 24, 24, 23, 22, 22, 22, 25, 25, 25, 26, 26, 26, 26, 25, 27,
+        28, 29, 27, 27, 29, 29, 30, 29, 31, 29, 31, 17, 29, 29, 28, 29,
+        29, 29, 27, 27, 30, 25, 32, 25, 26, 26, 25, 27, 25, 33, 34, 35,
+        36, 37, 38, 36, 36, 38, 36, 36, 39, 40, 41, 38, 42, 43, 44, 42,
+        42, 44, 42, 42, 45, 44, 46, 44, 35, 47, 48, 47, 48, 49, 48, 48,
+        47, 48, 47, 48, 47, 48, 49, 48, 48, 47, 48, 38, 48, 50, 48, 50,
+        48, 51, 52, 53, 52, 53, 54, 54, 53, 55, 53, 55, 53, 53, 53, 52,
+        53, 44, 53, 53, 52, 53, 52, 53, 52, 53, 51, 53, 52, 53, 52, 54,
+        54, 54, 52, 53, 52, 53, 52, 53, 52, 52, 53, 53, 53, 40, 40, 40,
+        56, 56, 56, 56, 40, 36, 40, 35, 49, 35, 27, 47, 49, 47, 49, 47,
+        47, 48, 47, 48, 47, 48, 47, 49, 47, 57, 47, 57, 47, 21, 23, 22,
+        23, 22, 24, 24, 22, 58, 22, 58, 22, 22, 22, 23, 22, 59, 60, 59,
+        61, 61, 59, 61, 61, 62, 25, 34, 25, 26, 26, 25, 33, 59, 61, 25,
+        63, 32, 32, 12, 12, 12, 14, 14, 12, 20, 12, 64, 12, 64, 19, 3,
+        3, 8, 6, 8, 6, 7, 7, 7, 8, 6, 8, 6, 8, 6, 3, 6,
+        8, 6, 8, 7, 7, 8, 8, 6, 8, 65, 66, 65, 2, 2, 65, 2,
+        2, 67, 0, 68, 0, 1, 1, 0, 2, 0, 69, 4, 4, 69, 3, 5,
+        6, 8, 6, 7, 7, 6, 6, 6, 70, 6, 70, 6, 6, 6, 0, 71,
+        0, 71, 68, 68, 71, 51, 42, 53, 52, 53, 52, 54, 54, 52, 72, 52,
+        72, 52, 52, 52, 53, 52, 73, 74, 73, 75, 75, 73, 75, 75, 76, 0,
+        4, 0, 1, 1, 0, 69, 0, 75, 0, 69, 0, 69, 69, 0, 71, 0,
+        71, 71, 73, 2, 73, 77, 73, 77, 73, 73, 75, 74, 74, 73, 73, 74,
+        73, 74, 73, 75, 74, 51, 42, 42, 78, 74, 73, 73, 76, 73, 77, 73,
+        73, 75, 73, 74, 74, 74, 52, 52, 65, 75, 65, 79, 65, 79, 65, 65,
+        2, 2, 3, 5, 2, 80, 66, 66, 66, 66, 65, 65, 66, 65, 66, 65,
+        65, 65, 67, 65, 65, 79, 65, 2, 65, 66, 66, 66, 8, 81, 8, 81,
+        8, 8, 8, 6, 8, 6, 8, 6, 8, 8, 6, 6, 8, 8, 8, 7,
+        82, 13, 6, 6, 8, 6, 8, 7, 7, 83, 8, 68, 7, 7, 8, 8,
+        6, 6, 6, 2, 19, 64, 12, 20, 12, 20, 20, 13, 20, 12, 64, 12,
+        64, 64, 63, 21, 15, 23, 22, 23, 24, 23, 23, 22, 23, 22, 23, 22,
+        23, 24, 23, 23, 22, 23, 23, 84, 23, 84, 23, 25, 33, 25, 33, 33,
+        34, 33, 25, 63, 25, 63, 63, 59, 27, 59, 85, 59, 85, 59, 59, 61,
+        61, 60, 21, 15, 15, 86, 60, 60, 60, 59, 59, 60, 59, 60, 59, 59,
+        59, 62, 59, 59, 85, 59, 61, 59, 60, 60, 60, 22, 22, 23, 22, 23,
+        22, 23, 22, 22, 47, 49, 48, 47, 49, 47, 47, 35, 48, 47, 48, 47,
+        49, 49, 47, 48, 48, 48, 49, 47, 49, 87, 47, 32, 47, 48, 47, 48,
+        49, 49, 49, 48, 48, 47, 47, 47, 49, 88, 41, 48, 89, 90, 40, 42,
+        40, 51, 41, 41, 91, 51, 75, 52, 54, 52, 54, 54, 52, 54, 40, 42,
+        40, 91, 41, 51, 75, 40, 36, 40, 90, 89, 35, 27, 47, 48, 47, 49,
+        40, 90, 40, 91, 40, 90, 40, 90, 90, 40, 91, 40, 91, 91, 54, 92,
+        52, 4, 52, 53, 52, 53, 54, 54, 93, 89, 53, 54, 54, 53, 53, 52,
+        52, 52, 48, 40, 89, 40, 56, 56, 44, 36, 44, 46, 44, 42, 42, 51,
+        75, 42, 94, 43, 43, 43, 43, 44, 44, 43, 44, 43, 44, 44, 44, 45,
+        44, 46, 44, 44, 42, 44, 43, 43, 43, 38, 95, 40, 56, 56, 38, 38,
+        95, 38, 38, 36, 36, 35, 27, 27, 96, 37, 37, 37, 37, 38, 38, 37,
+        38, 37, 38, 38, 38, 39, 38, 95, 38, 38, 36, 38, 37, 37, 37, 25,
+        63, 29, 61, 29, 31, 29, 29, 27, 27, 35, 36, 27, 97, 28, 28, 28,
+        28, 29, 29, 28, 29, 27, 29, 28, 28, 28, 25, 35, 34, 35, 36, 48,
+        49, 48, 49, 49, 48, 49, 25, 61, 25, 21, 24, 21, 15, 23, 24, 23,
+        24, 24, 23, 24, 25, 24, 23, 24, 98, 23, 19, 23, 22, 23, 22, 24,
+        24, 99, 34, 22, 24, 24, 22, 22, 23, 23, 23, 61, 17, 5, 17, 100,
+        17, 100, 17, 17, 15, 16, 16, 17, 17, 16, 17, 16, 17, 15, 16, 21,
+        61, 15, 101, 16, 17, 17, 18, 17, 100, 17, 17, 15, 17, 16, 16, 16,
+        12, 21, 13, 21, 61, 22, 24, 22, 24, 24, 22, 24, 12, 5, 12, 3,
+        7, 3, 2, 8, 7, 8, 7, 7, 8, 7, 12, 5, 9, 9, 15, 9,
+        102, 9, 102, 9, 9, 5, 5, 3, 2, 2, 103, 10, 10, 10, 10, 9,
+        9, 10, 9, 10, 9, 9, 9, 11, 9, 102, 9, 9, 5, 9, 10, 10,
+        10, 0, 75, 0, 51, 68, 51, 42, 53, 54, 53, 54, 54, 53, 54
+    };
+    static constexpr int degree_by_type[991] = {
+        1, 1, 1, 3, 3, 3, 3, 1, 2, 1, 3, 2, 3, 2, 1, 2,
+        1, 2, 2, 1, 2, 1, 1, 1, 1, 1, 2, 2, 1, 2, 2, 2,
+        1, 2, 1, 3, 3, 3, 3, 1, 2, 1, 1, 2, 2, 1, 2, 2,
+        2, 1, 2, 1, 3, 3, 1, 2, 1, 1, 2, 3, 3, 1, 1, 1,
+        1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3, 1, 2,
+        1, 1, 2, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 2, 2, 2, 1, 2, 1, 3, 3, 1, 2, 1, 1, 2, 3,
+        2, 1, 1, 2, 2, 1, 2, 2, 2, 1, 2, 1, 2, 1, 1, 2,
+        2, 1, 2, 2, 2, 1, 1, 1, 3, 1, 1, 1, 1, 2, 1, 1,
+        1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 3, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 2,
+        2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        3, 3, 3, 3, 1, 2, 1, 3, 2, 3, 2, 1, 2, 1, 2, 1,
+        1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 3, 1, 1,
+        1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        2, 2, 1, 2, 2, 2, 1, 2, 1, 3, 3, 1, 1, 1, 2, 1,
+        1, 2, 2, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 1, 2, 3,
+        3, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 3, 1,
+        1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 2,
+        2, 2, 1, 2, 1, 3, 3, 1, 2, 1, 1, 2, 2, 1, 3, 2,
+        1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 2, 2, 1, 3, 2, 1, 1, 1, 1, 2, 2, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 2, 2, 2, 1,
+        2, 1, 3, 3, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1,
+        1, 1, 1, 2, 1, 3, 2, 2, 1, 1, 1, 1, 2, 1, 1, 1,
+        1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1,
+        2, 2, 3, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+        2, 2, 1, 1, 1, 1, 1, 2, 2, 2, 1, 2, 2, 2, 1, 1,
+        1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1,
+        1, 1, 1, 3, 2, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1,
+        1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 2,
+        2, 1, 3, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 3, 1, 1, 1, 1,
+        2, 2, 1, 1, 1, 1, 2, 1, 2, 2, 1, 2, 1, 1, 1, 1,
+        2, 2, 2, 1, 1, 1, 1, 1, 2, 2, 2, 1, 2, 1, 1, 2,
+        1, 3, 2, 2, 1, 3, 2, 1, 2, 1, 2, 2, 1, 2, 1, 2,
+        1, 1, 2, 3, 2, 1, 2, 1, 1, 2, 3, 2, 1, 1, 1, 2,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+        1, 2, 1, 1, 1, 1, 2, 2, 2, 2, 1, 2, 2, 1, 1, 1,
+        1, 1, 1, 1, 2, 1, 3, 3, 1, 2, 1, 1, 1, 2, 2, 3,
+        2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+        1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 3, 3, 1, 1,
+        1, 1, 1, 2, 2, 3, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1,
+        1, 1, 2, 1, 1, 1, 1, 2, 2, 3, 2, 2, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 3, 2, 3, 2, 1,
+        2, 1, 2, 2, 1, 2, 1, 2, 1, 3, 2, 3, 2, 1, 2, 1,
+        2, 2, 1, 2, 1, 2, 1, 2, 2, 1, 2, 1, 1, 1, 1, 2,
+        2, 2, 2, 1, 2, 2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 1,
+        1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 3,
+        2, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1,
+        1, 3, 2, 3, 2, 1, 2, 1, 2, 2, 1, 2, 1, 2, 1, 3,
+        2, 3, 2, 1, 2, 1, 2, 2, 1, 2, 1, 2, 1, 1, 2, 1,
+        1, 1, 1, 1, 1, 2, 2, 3, 2, 2, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1, 1, 1,
+        1, 1, 2, 1, 3, 2, 3, 2, 1, 2, 1, 2, 2, 1, 2
+    };
+    static constexpr Step succ[991][3] = {
+        {{0, 1, 1, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 0
+        {{0, 1, 2, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 1
+        {{0, 1, 3, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 2
+        {{0, 1, 4, 1}, {1, 0, 392, 0}, {-1, 0, 397, 0}},  // 3
+        {{0, 1, 5, 1}, {1, 0, 388, 0}, {-1, 0, 350, 0}},  // 4
+        {{0, 1, 6, 1}, {1, 0, 327, 0}, {-1, 0, 390, 0}},  // 5
+        {{0, 1, 6, 1}, {1, 0, 7, 0}, {-1, 0, 977, 0}},  // 6
+        {{0, 1, 8, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 7
+        {{1, 0, 9, 0}, {0, 1, 314, 66}, {0, 0, 0, 0}},  // 8
+        {{0, 1, 10, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 9
+        {{1, 0, 11, 4}, {1, 1, 288, 3}, {0, 1, 303, 6}},  // 10
+        {{0, 1, 12, 3}, {1, 0, 332, 4}, {0, 0, 0, 0}},  // 11
+        {{1, 0, 13, 5}, {1, 1, 288, 3}, {0, 1, 303, 6}},  // 12
+        {{0, 1, 14, 6}, {1, 0, 24, 10}, {0, 0, 0, 0}},  // 13
+        {{1, 0, 15, 7}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 14
+        {{0, 1, 16, 6}, {1, 0, 340, 7}, {0, 0, 0, 0}},  // 15
+        {{1, 0, 17, 7}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 16
+        {{1, 0, 18, 7}, {0, 1, 348, 6}, {0, 0, 0, 0}},  // 17
+        {{0, 1, 19, 6}, {1, 0, 343, 6}, {0, 0, 0, 0}},  // 18
+        {{1, 0, 20, 7}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 19
+        {{1, 0, 21, 8}, {0, 1, 299, 6}, {0, 0, 0, 0}},  // 20
+        {{0, 1, 22, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 21
+        {{1, 0, 23, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 22
+        {{1, 0, 24, 10}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 23
+        {{0, 1, 25, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 24
+        {{1, 0, 26, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 25
+        {{1, 0, 27, 5}, {0, 1, 971, 9}, {0, 0, 0, 0}},  // 26
+        {{0, 1, 28, 9}, {1, 0, 965, 9}, {0, 0, 0, 0}},  // 27
+        {{1, 0, 29, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 28
+        {{1, 0, 30, 5}, {0, 1, 948, 9}, {0, 0, 0, 0}},  // 29
+        {{0, 1, 28, 9}, {1, 0, 31, 11}, {0, 0, 0, 0}},  // 30
+        {{1, 0, 32, 12}, {0, -1, 945, 9}, {0, 0, 0, 0}},  // 31
+        {{1, 0, 33, 13}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 32
+        {{1, 0, 34, 12}, {0, -1, 941, 9}, {0, 0, 0, 0}},  // 33
+        {{1, 0, 35, 14}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 34
+        {{1, 0, 36, 14}, {0, -1, 518, 12}, {0, 1, 525, 12}},  // 35
+        {{1, 0, 37, 14}, {0, -1, 280, 12}, {0, 1, 940, 9}},  // 36
+        {{1, 0, 38, 14}, {0, -1, 54, 12}, {0, 1, 938, 12}},  // 37
+        {{1, 0, 38, 14}, {0, -1, 39, 12}, {0, 1, 924, 12}},  // 38
+        {{1, 0, 40, 15}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 39
+        {{1, 0, 41, 16}, {0, -1, 912, 12}, {0, 0, 0, 0}},  // 40
+        {{0, -1, 42, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 41
+        {{1, 0, 43, 15}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 42
+        {{1, 0, 44, 15}, {0, -1, 906, 17}, {0, 0, 0, 0}},  // 43
+        {{0, -1, 45, 17}, {1, 0, 900, 17}, {0, 0, 0, 0}},  // 44
+        {{1, 0, 46, 15}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 45
+        {{1, 0, 47, 15}, {0, -1, 883, 17}, {0, 0, 0, 0}},  // 46
+        {{0, -1, 45, 17}, {1, 0, 48, 18}, {0, 0, 0, 0}},  // 47
+        {{1, 0, 49, 12}, {0, 1, 880, 17}, {0, 0, 0, 0}},  // 48
+        {{1, 0, 50, 19}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 49
+        {{1, 0, 51, 12}, {0, 1, 876, 17}, {0, 0, 0, 0}},  // 50
+        {{1, 0, 52, 14}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 51
+        {{1, 0, 53, 14}, {0, -1, 518, 12}, {0, 1, 525, 12}},  // 52
+        {{1, 0, 37, 14}, {0, -1, 54, 12}, {0, 1, 282, 12}},  // 53
+        {{1, 0, 55, 15}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 54
+        {{0, -1, 56, 12}, {1, 0, 41, 16}, {0, 0, 0, 0}},  // 55
+        {{1, 0, 57, 20}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 56
+        {{0, -1, 58, 13}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 57
+        {{1, 0, 59, 21}, {0, -1, 523, 13}, {0, 0, 0, 0}},  // 58
+        {{1, -1, 60, 21}, {0, -1, 875, 61}, {1, 0, 611, 22}},  // 59
+        {{1, 0, 61, 22}, {1, -1, 60, 21}, {0, -1, 859, 23}},  // 60
+        {{0, -1, 62, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 61
+        {{1, 0, 63, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 62
+        {{0, -1, 64, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 63
+        {{1, 0, 65, 24}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 64
+        {{0, -1, 66, 24}, {1, 0, 855, 24}, {0, 0, 0, 0}},  // 65
+        {{0, -1, 67, 23}, {1, 0, 853, 24}, {0, 0, 0, 0}},  // 66
+        {{1, 0, 68, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 67
+        {{0, -1, 69, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 68
+        {{0, -1, 70, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 69
+        {{0, -1, 71, 25}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 70
+        {{0, -1, 72, 25}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 71
+        {{0, -1, 73, 25}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 72
+        {{0, -1, 74, 26}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 73
+        {{0, -1, 75, 26}, {-1, 0, 555, 25}, {1, 0, 562, 25}},  // 74
+        {{0, -1, 76, 26}, {-1, 0, 267, 25}, {1, 0, 799, 25}},  // 75
+        {{0, -1, 77, 26}, {-1, 0, 106, 25}, {1, 0, 852, 25}},  // 76
+        {{0, -1, 77, 26}, {-1, 0, 78, 25}, {1, 0, 838, 25}},  // 77
+        {{0, -1, 79, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 78
+        {{0, -1, 80, 28}, {-1, 0, 826, 25}, {0, 0, 0, 0}},  // 79
+        {{-1, 0, 81, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 80
+        {{0, -1, 82, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 81
+        {{0, -1, 83, 27}, {-1, 0, 820, 29}, {0, 0, 0, 0}},  // 82
+        {{0, -1, 84, 29}, {-1, 0, 97, 29}, {0, 0, 0, 0}},  // 83
+        {{0, -1, 85, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 84
+        {{0, -1, 86, 30}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 85
+        {{1, 0, 87, 29}, {0, -1, 92, 29}, {0, 0, 0, 0}},  // 86
+        {{0, -1, 88, 31}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 87
+        {{1, 0, 89, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 88
+        {{0, -1, 90, 31}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 89
+        {{1, 0, 91, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 90
+        {{1, 0, 41, 16}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 91
+        {{0, -1, 93, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 92
+        {{0, -1, 94, 28}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 93
+        {{-1, 0, 95, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 94
+        {{0, -1, 96, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 95
+        {{0, -1, 80, 28}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 96
+        {{0, -1, 98, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 97
+        {{0, -1, 99, 27}, {-1, 0, 806, 29}, {0, 0, 0, 0}},  // 98
+        {{0, -1, 100, 30}, {-1, 0, 97, 29}, {0, 0, 0, 0}},  // 99
+        {{0, -1, 101, 25}, {1, 0, 803, 29}, {0, 0, 0, 0}},  // 100
+        {{0, -1, 102, 32}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 101
+        {{0, -1, 103, 25}, {1, 0, 801, 29}, {0, 0, 0, 0}},  // 102
+        {{0, -1, 104, 26}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 103
+        {{0, -1, 105, 26}, {-1, 0, 555, 25}, {1, 0, 562, 25}},  // 104
+        {{0, -1, 76, 26}, {-1, 0, 106, 25}, {1, 0, 799, 25}},  // 105
+        {{0, -1, 107, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 106
+        {{0, -1, 80, 28}, {-1, 0, 108, 25}, {0, 0, 0, 0}},  // 107
+        {{0, -1, 109, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 108
+        {{-1, 0, 110, 34}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 109
+        {{0, -1, 111, 35}, {-1, 0, 560, 34}, {0, 0, 0, 0}},  // 110
+        {{-1, 0, 112, 36}, {0, -1, 722, 48}, {-1, -1, 619, 35}},  // 111
+        {{-1, 0, 113, 37}, {0, -1, 138, 48}, {0, 0, 0, 0}},  // 112
+        {{0, -1, 114, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 113
+        {{-1, 0, 115, 36}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 114
+        {{-1, 0, 116, 36}, {0, -1, 793, 38}, {0, 0, 0, 0}},  // 115
+        {{0, -1, 117, 38}, {-1, 0, 787, 38}, {0, 0, 0, 0}},  // 116
+        {{-1, 0, 118, 36}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 117
+        {{-1, 0, 119, 36}, {0, -1, 770, 38}, {0, 0, 0, 0}},  // 118
+        {{0, -1, 117, 38}, {-1, 0, 120, 39}, {0, 0, 0, 0}},  // 119
+        {{-1, 0, 121, 40}, {0, 1, 767, 38}, {0, 0, 0, 0}},  // 120
+        {{-1, 0, 122, 41}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 121
+        {{0, 1, 123, 38}, {-1, 0, 763, 40}, {0, 0, 0, 0}},  // 122
+        {{-1, 0, 124, 42}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 123
+        {{-1, 0, 125, 43}, {0, 1, 761, 38}, {0, 0, 0, 0}},  // 124
+        {{0, 1, 126, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 125
+        {{-1, 0, 127, 42}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 126
+        {{-1, 0, 128, 42}, {0, 1, 755, 44}, {0, 0, 0, 0}},  // 127
+        {{0, 1, 129, 44}, {-1, 0, 749, 44}, {0, 0, 0, 0}},  // 128
+        {{-1, 0, 130, 42}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 129
+        {{-1, 0, 131, 42}, {0, 1, 732, 44}, {0, 0, 0, 0}},  // 130
+        {{0, 1, 129, 44}, {-1, 0, 132, 45}, {0, 0, 0, 0}},  // 131
+        {{0, -1, 133, 44}, {-1, 0, 723, 40}, {0, 0, 0, 0}},  // 132
+        {{-1, 0, 134, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 133
+        {{0, -1, 135, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 134
+        {{-1, 0, 136, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 135
+        {{-1, 0, 137, 47}, {0, -1, 722, 48}, {-1, -1, 619, 35}},  // 136
+        {{0, -1, 138, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 137
+        {{-1, 0, 139, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 138
+        {{0, -1, 140, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 139
+        {{-1, 0, 141, 49}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 140
+        {{0, -1, 142, 48}, {-1, 0, 150, 49}, {0, 0, 0, 0}},  // 141
+        {{-1, 0, 143, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 142
+        {{-1, 0, 144, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 143
+        {{0, -1, 145, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 144
+        {{-1, 0, 146, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 145
+        {{0, -1, 147, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 146
+        {{-1, 0, 148, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 147
+        {{0, -1, 149, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 148
+        {{-1, 0, 136, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 149
+        {{0, -1, 151, 48}, {-1, 0, 156, 48}, {0, 0, 0, 0}},  // 150
+        {{-1, 0, 152, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 151
+        {{-1, 0, 153, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 152
+        {{0, -1, 154, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 153
+        {{-1, 0, 155, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 154
+        {{-1, 0, 113, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 155
+        {{-1, 0, 157, 50}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 156
+        {{0, 1, 158, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 157
+        {{-1, 0, 159, 50}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 158
+        {{0, 1, 160, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 159
+        {{-1, 0, 161, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 160
+        {{-1, 0, 162, 52}, {-1, 1, 186, 51}, {0, 1, 359, 53}},  // 161
+        {{0, 1, 163, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 162
+        {{-1, 0, 164, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 163
+        {{0, 1, 165, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 164
+        {{-1, 0, 166, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 165
+        {{-1, 0, 167, 54}, {0, 1, 178, 53}, {0, 0, 0, 0}},  // 166
+        {{-1, 0, 168, 53}, {0, 1, 173, 53}, {0, 0, 0, 0}},  // 167
+        {{-1, 0, 169, 55}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 168
+        {{0, -1, 170, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 169
+        {{-1, 0, 171, 55}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 170
+        {{0, -1, 172, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 171
+        {{-1, 0, 136, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 172
+        {{-1, 0, 174, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 173
+        {{-1, 0, 175, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 174
+        {{0, 1, 176, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 175
+        {{-1, 0, 177, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 176
+        {{-1, 0, 125, 43}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 177
+        {{-1, 0, 179, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 178
+        {{-1, 0, 180, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 179
+        {{0, 1, 181, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 180
+        {{-1, 0, 182, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 181
+        {{0, 1, 183, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 182
+        {{-1, 0, 184, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 183
+        {{0, 1, 185, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 184
+        {{-1, 0, 161, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 185
+        {{-1, 1, 186, 51}, {0, 1, 187, 53}, {-1, 0, 706, 52}},  // 186
+        {{-1, 0, 188, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 187
+        {{0, 1, 189, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 188
+        {{-1, 0, 190, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 189
+        {{0, 1, 191, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 190
+        {{-1, 0, 192, 54}, {0, 1, 702, 54}, {0, 0, 0, 0}},  // 191
+        {{0, 1, 193, 54}, {-1, 0, 201, 52}, {0, 0, 0, 0}},  // 192
+        {{-1, 0, 194, 52}, {0, 1, 195, 53}, {0, 0, 0, 0}},  // 193
+        {{0, 1, 173, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 194
+        {{-1, 0, 196, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 195
+        {{0, 1, 197, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 196
+        {{-1, 0, 198, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 197
+        {{0, 1, 199, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 198
+        {{-1, 0, 200, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 199
+        {{0, 1, 161, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 200
+        {{0, 1, 202, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 201
+        {{-1, 0, 203, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 202
+        {{-1, 0, 204, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 203
+        {{-1, 0, 205, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 204
+        {{-1, 0, 206, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 205
+        {{-1, 0, 207, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 206
+        {{-1, 0, 208, 56}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 207
+        {{-1, 0, 209, 56}, {0, -1, 692, 40}, {0, 1, 697, 40}},  // 208
+        {{-1, 0, 210, 56}, {0, -1, 688, 40}, {0, 1, 690, 40}},  // 209
+        {{-1, 0, 211, 56}, {0, 1, 670, 40}, {0, -1, 677, 40}},  // 210
+        {{-1, 0, 211, 56}, {0, -1, 212, 40}, {0, 1, 654, 40}},  // 211
+        {{-1, 0, 213, 36}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 212
+        {{-1, 0, 113, 37}, {0, -1, 214, 40}, {0, 0, 0, 0}},  // 213
+        {{-1, 0, 215, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 214
+        {{0, -1, 216, 49}, {-1, 0, 137, 47}, {-1, -1, 619, 35}},  // 215
+        {{-1, 0, 217, 35}, {0, -1, 652, 89}, {0, 0, 0, 0}},  // 216
+        {{0, -1, 218, 27}, {-1, 0, 137, 47}, {-1, -1, 619, 35}},  // 217
+        {{-1, 0, 219, 47}, {0, -1, 80, 28}, {0, 0, 0, 0}},  // 218
+        {{0, -1, 220, 49}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 219
+        {{-1, 0, 221, 47}, {0, -1, 616, 49}, {0, 0, 0, 0}},  // 220
+        {{0, -1, 222, 49}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 221
+        {{-1, 0, 223, 47}, {0, -1, 231, 49}, {0, 0, 0, 0}},  // 222
+        {{0, -1, 224, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 223
+        {{0, -1, 225, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 224
+        {{-1, 0, 226, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 225
+        {{0, -1, 227, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 226
+        {{-1, 0, 228, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 227
+        {{0, -1, 229, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 228
+        {{-1, 0, 230, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 229
+        {{0, -1, 136, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 230
+        {{0, -1, 232, 47}, {-1, 0, 612, 47}, {0, 0, 0, 0}},  // 231
+        {{0, -1, 233, 57}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 232
+        {{1, 0, 234, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 233
+        {{0, -1, 235, 57}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 234
+        {{1, 0, 236, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 235
+        {{0, -1, 237, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 236
+        {{1, -1, 60, 21}, {0, -1, 238, 23}, {1, 0, 611, 22}},  // 237
+        {{1, 0, 239, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 238
+        {{0, -1, 240, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 239
+        {{1, 0, 241, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 240
+        {{0, -1, 242, 24}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 241
+        {{0, -1, 243, 24}, {1, 0, 603, 22}, {0, 0, 0, 0}},  // 242
+        {{0, -1, 244, 22}, {1, 0, 249, 22}, {0, 0, 0, 0}},  // 243
+        {{0, -1, 245, 58}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 244
+        {{-1, 0, 246, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 245
+        {{0, -1, 247, 58}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 246
+        {{-1, 0, 248, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 247
+        {{0, -1, 136, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 248
+        {{0, -1, 250, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 249
+        {{0, -1, 251, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 250
+        {{1, 0, 252, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 251
+        {{0, -1, 253, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 252
+        {{0, -1, 254, 60}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 253
+        {{1, 0, 255, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 254
+        {{0, -1, 256, 61}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 255
+        {{0, -1, 257, 61}, {1, 0, 597, 59}, {0, 0, 0, 0}},  // 256
+        {{1, 0, 258, 59}, {0, -1, 591, 59}, {0, 0, 0, 0}},  // 257
+        {{0, -1, 259, 61}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 258
+        {{0, -1, 260, 61}, {1, 0, 574, 59}, {0, 0, 0, 0}},  // 259
+        {{1, 0, 258, 59}, {0, -1, 261, 62}, {0, 0, 0, 0}},  // 260
+        {{0, -1, 262, 25}, {-1, 0, 571, 59}, {0, 0, 0, 0}},  // 261
+        {{0, -1, 263, 34}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 262
+        {{0, -1, 264, 25}, {-1, 0, 567, 59}, {0, 0, 0, 0}},  // 263
+        {{0, -1, 265, 26}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 264
+        {{0, -1, 266, 26}, {-1, 0, 555, 25}, {1, 0, 562, 25}},  // 265
+        {{0, -1, 76, 26}, {-1, 0, 267, 25}, {1, 0, 269, 59}},  // 266
+        {{0, -1, 268, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 267
+        {{-1, 0, 108, 25}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 268
+        {{0, -1, 270, 61}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 269
+        {{1, 0, 271, 25}, {0, -1, 254, 60}, {0, 0, 0, 0}},  // 270
+        {{0, -1, 272, 63}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 271
+        {{1, 0, 273, 32}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 272
+        {{1, 0, 274, 32}, {0, -1, 531, 21}, {0, 0, 0, 0}},  // 273
+        {{1, 0, 275, 12}, {0, -1, 530, 63}, {0, 0, 0, 0}},  // 274
+        {{1, 0, 276, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 275
+        {{1, 0, 277, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 276
+        {{1, 0, 278, 14}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 277
+        {{1, 0, 279, 14}, {0, -1, 518, 12}, {0, 1, 525, 12}},  // 278
+        {{1, 0, 37, 14}, {0, -1, 280, 12}, {0, 1, 282, 12}},  // 279
+        {{1, 0, 281, 20}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 280
+        {{0, -1, 56, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 281
+        {{1, 0, 283, 64}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 282
+        {{0, 1, 284, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 283
+        {{1, 0, 285, 64}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 284
+        {{0, 1, 286, 19}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 285
+        {{1, 0, 287, 3}, {0, 1, 516, 19}, {0, 0, 0, 0}},  // 286
+        {{1, 1, 288, 3}, {0, 1, 515, 2}, {1, 0, 489, 8}},  // 287
+        {{1, 0, 289, 8}, {1, 1, 288, 3}, {0, 1, 499, 6}},  // 288
+        {{0, 1, 290, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 289
+        {{1, 0, 291, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 290
+        {{0, 1, 292, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 291
+        {{1, 0, 293, 7}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 292
+        {{0, 1, 294, 7}, {1, 0, 495, 7}, {0, 0, 0, 0}},  // 293
+        {{1, 0, 295, 7}, {0, 1, 491, 6}, {0, 0, 0, 0}},  // 294
+        {{1, 0, 296, 8}, {0, 1, 490, 6}, {0, 0, 0, 0}},  // 295
+        {{0, 1, 297, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 296
+        {{1, 0, 298, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 297
+        {{0, 1, 299, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 298
+        {{1, 0, 300, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 299
+        {{0, 1, 301, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 300
+        {{1, 0, 302, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 301
+        {{1, 1, 288, 3}, {0, 1, 303, 6}, {1, 0, 489, 8}},  // 302
+        {{1, 0, 304, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 303
+        {{0, 1, 305, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 304
+        {{1, 0, 306, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 305
+        {{0, 1, 307, 7}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 306
+        {{0, 1, 308, 7}, {1, 0, 481, 8}, {0, 0, 0, 0}},  // 307
+        {{1, 0, 309, 8}, {0, 1, 476, 8}, {0, 0, 0, 0}},  // 308
+        {{0, 1, 310, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 309
+        {{0, 1, 311, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 310
+        {{1, 0, 312, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 311
+        {{0, 1, 313, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 312
+        {{0, 1, 314, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 313
+        {{1, 0, 315, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 314
+        {{0, 1, 316, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 315
+        {{0, 1, 317, 2}, {1, 0, 470, 65}, {0, 0, 0, 0}},  // 316
+        {{1, 0, 318, 65}, {0, 1, 464, 65}, {0, 0, 0, 0}},  // 317
+        {{0, 1, 319, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 318
+        {{0, 1, 320, 2}, {1, 0, 447, 65}, {0, 0, 0, 0}},  // 319
+        {{1, 0, 318, 65}, {0, 1, 321, 67}, {0, 0, 0, 0}},  // 320
+        {{0, 1, 322, 0}, {-1, 0, 444, 65}, {0, 0, 0, 0}},  // 321
+        {{0, 1, 323, 68}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 322
+        {{0, 1, 324, 0}, {-1, 0, 440, 65}, {0, 0, 0, 0}},  // 323
+        {{0, 1, 325, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 324
+        {{0, 1, 326, 1}, {1, 0, 392, 0}, {-1, 0, 397, 0}},  // 325
+        {{0, 1, 5, 1}, {1, 0, 327, 0}, {-1, 0, 350, 0}},  // 326
+        {{0, 1, 328, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 327
+        {{1, 0, 329, 0}, {0, 1, 314, 66}, {0, 0, 0, 0}},  // 328
+        {{0, 1, 330, 69}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 329
+        {{1, 0, 331, 4}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 330
+        {{1, 0, 332, 4}, {0, 1, 334, 3}, {0, 0, 0, 0}},  // 331
+        {{0, 1, 333, 69}, {1, 0, 275, 12}, {0, 0, 0, 0}},  // 332
+        {{1, 0, 23, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 333
+        {{1, 1, 288, 3}, {0, 1, 303, 6}, {1, 0, 335, 5}},  // 334
+        {{0, 1, 336, 6}, {1, 0, 24, 10}, {0, 0, 0, 0}},  // 335
+        {{1, 0, 337, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 336
+        {{0, 1, 338, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 337
+        {{1, 0, 339, 7}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 338
+        {{1, 0, 340, 7}, {0, 1, 348, 6}, {0, 0, 0, 0}},  // 339
+        {{0, 1, 341, 6}, {1, 0, 343, 6}, {0, 0, 0, 0}},  // 340
+        {{1, 0, 342, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 341
+        {{1, 0, 21, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 342
+        {{1, 0, 344, 70}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 343
+        {{0, -1, 345, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 344
+        {{1, 0, 346, 70}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 345
+        {{0, -1, 347, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 346
+        {{1, 0, 237, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 347
+        {{1, 0, 349, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 348
+        {{1, 0, 296, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 349
+        {{0, 1, 351, 71}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 350
+        {{-1, 0, 352, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 351
+        {{0, 1, 353, 71}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 352
+        {{-1, 0, 354, 68}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 353
+        {{-1, 0, 355, 68}, {0, 1, 357, 51}, {0, 0, 0, 0}},  // 354
+        {{-1, 0, 205, 40}, {0, 1, 356, 71}, {0, 0, 0, 0}},  // 355
+        {{-1, 0, 177, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 356
+        {{-1, 0, 358, 42}, {-1, 1, 186, 51}, {0, 1, 359, 53}},  // 357
+        {{-1, 0, 125, 43}, {0, 1, 163, 53}, {0, 0, 0, 0}},  // 358
+        {{-1, 0, 360, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 359
+        {{0, 1, 361, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 360
+        {{-1, 0, 362, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 361
+        {{0, 1, 363, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 362
+        {{0, 1, 364, 54}, {-1, 0, 438, 52}, {0, 0, 0, 0}},  // 363
+        {{0, 1, 365, 52}, {-1, 0, 370, 52}, {0, 0, 0, 0}},  // 364
+        {{0, 1, 366, 72}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 365
+        {{1, 0, 367, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 366
+        {{0, 1, 368, 72}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 367
+        {{1, 0, 369, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 368
+        {{0, 1, 302, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 369
+        {{0, 1, 371, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 370
+        {{0, 1, 372, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 371
+        {{-1, 0, 373, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 372
+        {{0, 1, 374, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 373
+        {{0, 1, 375, 74}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 374
+        {{-1, 0, 376, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 375
+        {{0, 1, 377, 75}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 376
+        {{0, 1, 378, 75}, {-1, 0, 432, 73}, {0, 0, 0, 0}},  // 377
+        {{-1, 0, 379, 73}, {0, 1, 426, 73}, {0, 0, 0, 0}},  // 378
+        {{0, 1, 380, 75}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 379
+        {{0, 1, 381, 75}, {-1, 0, 409, 73}, {0, 0, 0, 0}},  // 380
+        {{-1, 0, 379, 73}, {0, 1, 382, 76}, {0, 0, 0, 0}},  // 381
+        {{0, 1, 383, 0}, {1, 0, 406, 73}, {0, 0, 0, 0}},  // 382
+        {{0, 1, 384, 4}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 383
+        {{0, 1, 385, 0}, {1, 0, 402, 73}, {0, 0, 0, 0}},  // 384
+        {{0, 1, 386, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 385
+        {{0, 1, 387, 1}, {1, 0, 392, 0}, {-1, 0, 397, 0}},  // 386
+        {{0, 1, 5, 1}, {1, 0, 388, 0}, {-1, 0, 390, 0}},  // 387
+        {{0, 1, 389, 69}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 388
+        {{1, 0, 329, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 389
+        {{0, 1, 391, 75}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 390
+        {{0, 1, 375, 74}, {-1, 0, 352, 0}, {0, 0, 0, 0}},  // 391
+        {{0, 1, 393, 69}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 392
+        {{1, 0, 394, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 393
+        {{0, 1, 395, 69}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 394
+        {{1, 0, 396, 69}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 395
+        {{1, 0, 332, 4}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 396
+        {{0, 1, 398, 71}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 397
+        {{-1, 0, 399, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 398
+        {{0, 1, 400, 71}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 399
+        {{-1, 0, 401, 71}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 400
+        {{-1, 0, 355, 68}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 401
+        {{0, 1, 403, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 402
+        {{0, 1, 314, 66}, {1, 0, 404, 73}, {0, 0, 0, 0}},  // 403
+        {{0, 1, 405, 77}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 404
+        {{1, 0, 23, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 405
+        {{0, 1, 407, 77}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 406
+        {{1, 0, 408, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 407
+        {{0, 1, 302, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 408
+        {{0, 1, 410, 75}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 409
+        {{0, 1, 411, 74}, {-1, 0, 419, 75}, {0, 0, 0, 0}},  // 410
+        {{-1, 0, 412, 74}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 411
+        {{-1, 0, 413, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 412
+        {{0, 1, 414, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 413
+        {{0, 1, 415, 74}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 414
+        {{-1, 0, 416, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 415
+        {{0, 1, 417, 74}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 416
+        {{-1, 0, 418, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 417
+        {{0, 1, 374, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 418
+        {{-1, 0, 420, 74}, {0, 1, 421, 51}, {0, 0, 0, 0}},  // 419
+        {{-1, 0, 205, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 420
+        {{-1, 0, 422, 42}, {-1, 1, 186, 51}, {0, 1, 359, 53}},  // 421
+        {{-1, 0, 423, 42}, {0, 1, 163, 53}, {0, 0, 0, 0}},  // 422
+        {{0, 1, 126, 44}, {-1, 0, 424, 78}, {0, 0, 0, 0}},  // 423
+        {{0, -1, 425, 74}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 424
+        {{-1, 0, 155, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 425
+        {{0, 1, 427, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 426
+        {{0, 1, 428, 76}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 427
+        {{1, 0, 429, 73}, {0, 1, 431, 73}, {0, 0, 0, 0}},  // 428
+        {{0, 1, 430, 77}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 429
+        {{1, 0, 404, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 430
+        {{0, 1, 416, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 431
+        {{0, 1, 433, 75}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 432
+        {{0, 1, 411, 74}, {-1, 0, 434, 73}, {0, 0, 0, 0}},  // 433
+        {{0, 1, 435, 74}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 434
+        {{-1, 0, 436, 74}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 435
+        {{-1, 0, 437, 74}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 436
+        {{-1, 0, 424, 78}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 437
+        {{0, 1, 439, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 438
+        {{0, 1, 195, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 439
+        {{0, 1, 441, 75}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 440
+        {{-1, 0, 442, 65}, {0, 1, 375, 74}, {0, 0, 0, 0}},  // 441
+        {{0, 1, 443, 79}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 442
+        {{-1, 0, 177, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 443
+        {{0, 1, 445, 79}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 444
+        {{-1, 0, 446, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 445
+        {{0, 1, 161, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 446
+        {{0, 1, 448, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 447
+        {{1, 0, 449, 2}, {0, 1, 456, 66}, {0, 0, 0, 0}},  // 448
+        {{0, 1, 450, 3}, {1, 0, 455, 66}, {0, 0, 0, 0}},  // 449
+        {{1, 1, 288, 3}, {1, 0, 451, 5}, {0, 1, 303, 6}},  // 450
+        {{0, 1, 336, 6}, {1, 0, 452, 2}, {0, 0, 0, 0}},  // 451
+        {{0, 1, 25, 9}, {1, 0, 453, 80}, {0, 0, 0, 0}},  // 452
+        {{0, -1, 454, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 453
+        {{1, 0, 91, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 454
+        {{1, 0, 275, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 455
+        {{1, 0, 457, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 456
+        {{1, 0, 458, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 457
+        {{0, 1, 459, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 458
+        {{0, 1, 460, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 459
+        {{1, 0, 461, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 460
+        {{0, 1, 462, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 461
+        {{1, 0, 463, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 462
+        {{0, 1, 313, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 463
+        {{0, 1, 465, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 464
+        {{0, 1, 466, 67}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 465
+        {{0, 1, 467, 65}, {-1, 0, 468, 65}, {0, 0, 0, 0}},  // 466
+        {{0, 1, 461, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 467
+        {{0, 1, 469, 79}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 468
+        {{-1, 0, 442, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 469
+        {{0, 1, 471, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 470
+        {{1, 0, 472, 65}, {0, 1, 456, 66}, {0, 0, 0, 0}},  // 471
+        {{0, 1, 473, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 472
+        {{1, 0, 474, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 473
+        {{1, 0, 475, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 474
+        {{1, 0, 453, 80}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 475
+        {{0, 1, 477, 81}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 476
+        {{-1, 0, 478, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 477
+        {{0, 1, 479, 81}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 478
+        {{-1, 0, 480, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 479
+        {{0, 1, 161, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 480
+        {{0, 1, 482, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 481
+        {{0, 1, 483, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 482
+        {{1, 0, 484, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 483
+        {{0, 1, 485, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 484
+        {{1, 0, 486, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 485
+        {{0, 1, 487, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 486
+        {{1, 0, 488, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 487
+        {{0, 1, 302, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 488
+        {{0, 1, 336, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 489
+        {{1, 0, 309, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 490
+        {{1, 0, 492, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 491
+        {{0, 1, 493, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 492
+        {{0, 1, 494, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 493
+        {{0, 1, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 494
+        {{1, 0, 496, 82}, {0, 1, 341, 6}, {0, 0, 0, 0}},  // 495
+        {{1, 0, 497, 13}, {0, -1, 498, 6}, {0, 0, 0, 0}},  // 496
+        {{1, 0, 276, 12}, {0, -1, 345, 6}, {0, 0, 0, 0}},  // 497
+        {{1, 0, 91, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 498
+        {{1, 0, 500, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 499
+        {{0, 1, 501, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 500
+        {{1, 0, 502, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 501
+        {{0, 1, 503, 7}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 502
+        {{0, 1, 504, 7}, {1, 0, 508, 7}, {0, 0, 0, 0}},  // 503
+        {{0, 1, 505, 83}, {1, 0, 309, 8}, {0, 0, 0, 0}},  // 504
+        {{-1, 0, 506, 8}, {0, 1, 507, 68}, {0, 0, 0, 0}},  // 505
+        {{0, 1, 374, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 506
+        {{0, 1, 1, 0}, {-1, 0, 478, 8}, {0, 0, 0, 0}},  // 507
+        {{0, 1, 509, 7}, {1, 0, 511, 8}, {0, 0, 0, 0}},  // 508
+        {{0, 1, 483, 6}, {1, 0, 510, 8}, {0, 0, 0, 0}},  // 509
+        {{0, 1, 341, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 510
+        {{0, 1, 512, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 511
+        {{1, 0, 513, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 512
+        {{1, 0, 514, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 513
+        {{1, 0, 275, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 514
+        {{0, 1, 314, 66}, {1, 0, 304, 8}, {0, 0, 0, 0}},  // 515
+        {{0, 1, 0, 0}, {1, 0, 517, 64}, {0, 0, 0, 0}},  // 516
+        {{0, 1, 313, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 517
+        {{1, 0, 519, 20}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 518
+        {{0, -1, 520, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 519
+        {{1, 0, 521, 20}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 520
+        {{0, -1, 522, 20}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 521
+        {{0, -1, 523, 13}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 522
+        {{1, 0, 524, 20}, {0, -1, 71, 25}, {0, 0, 0, 0}},  // 523
+        {{0, -1, 253, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 524
+        {{1, 0, 526, 64}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 525
+        {{0, 1, 527, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 526
+        {{1, 0, 528, 64}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 527
+        {{0, 1, 529, 64}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 528
+        {{0, 1, 516, 19}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 529
+        {{1, 0, 91, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 530
+        {{1, -1, 60, 21}, {0, -1, 238, 23}, {1, 0, 532, 15}},  // 531
+        {{1, 0, 41, 16}, {0, -1, 533, 23}, {0, 0, 0, 0}},  // 532
+        {{1, 0, 534, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 533
+        {{0, -1, 535, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 534
+        {{1, 0, 536, 24}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 535
+        {{0, -1, 537, 23}, {1, 0, 545, 24}, {0, 0, 0, 0}},  // 536
+        {{1, 0, 538, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 537
+        {{1, 0, 539, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 538
+        {{0, -1, 540, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 539
+        {{1, 0, 541, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 540
+        {{0, -1, 542, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 541
+        {{1, 0, 543, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 542
+        {{0, -1, 544, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 543
+        {{1, 0, 237, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 544
+        {{0, -1, 546, 23}, {1, 0, 550, 23}, {0, 0, 0, 0}},  // 545
+        {{1, 0, 547, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 546
+        {{1, 0, 548, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 547
+        {{0, -1, 549, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 548
+        {{1, 0, 91, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 549
+        {{1, 0, 551, 84}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 550
+        {{0, 1, 552, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 551
+        {{1, 0, 553, 84}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 552
+        {{0, 1, 554, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 553
+        {{1, 0, 302, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 554
+        {{0, -1, 556, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 555
+        {{-1, 0, 557, 25}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 556
+        {{0, -1, 558, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 557
+        {{-1, 0, 559, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 558
+        {{-1, 0, 560, 34}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 559
+        {{0, -1, 561, 33}, {-1, 0, 205, 40}, {0, 0, 0, 0}},  // 560
+        {{-1, 0, 155, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 561
+        {{0, -1, 563, 63}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 562
+        {{1, 0, 564, 25}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 563
+        {{0, -1, 565, 63}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 564
+        {{1, 0, 566, 63}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 565
+        {{1, 0, 274, 32}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 566
+        {{0, -1, 568, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 567
+        {{0, -1, 80, 28}, {-1, 0, 569, 59}, {0, 0, 0, 0}},  // 568
+        {{0, -1, 570, 85}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 569
+        {{-1, 0, 155, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 570
+        {{0, -1, 572, 85}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 571
+        {{-1, 0, 573, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 572
+        {{0, -1, 136, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 573
+        {{0, -1, 575, 61}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 574
+        {{1, 0, 576, 61}, {0, -1, 583, 60}, {0, 0, 0, 0}},  // 575
+        {{1, 0, 577, 60}, {0, -1, 578, 21}, {0, 0, 0, 0}},  // 576
+        {{1, 0, 275, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 577
+        {{1, -1, 60, 21}, {0, -1, 238, 23}, {1, 0, 579, 15}},  // 578
+        {{1, 0, 580, 15}, {0, -1, 533, 23}, {0, 0, 0, 0}},  // 579
+        {{0, -1, 42, 17}, {1, 0, 581, 86}, {0, 0, 0, 0}},  // 580
+        {{0, 1, 582, 60}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 581
+        {{1, 0, 23, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 582
+        {{1, 0, 584, 60}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 583
+        {{1, 0, 585, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 584
+        {{0, -1, 586, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 585
+        {{0, -1, 587, 60}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 586
+        {{1, 0, 588, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 587
+        {{0, -1, 589, 60}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 588
+        {{1, 0, 590, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 589
+        {{0, -1, 253, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 590
+        {{0, -1, 592, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 591
+        {{0, -1, 593, 62}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 592
+        {{0, -1, 594, 59}, {-1, 0, 595, 59}, {0, 0, 0, 0}},  // 593
+        {{0, -1, 588, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 594
+        {{0, -1, 596, 85}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 595
+        {{-1, 0, 569, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 596
+        {{0, -1, 598, 61}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 597
+        {{0, -1, 583, 60}, {1, 0, 599, 59}, {0, 0, 0, 0}},  // 598
+        {{0, -1, 600, 60}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 599
+        {{1, 0, 601, 60}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 600
+        {{1, 0, 602, 60}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 601
+        {{1, 0, 581, 86}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 602
+        {{0, -1, 604, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 603
+        {{0, -1, 605, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 604
+        {{1, 0, 606, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 605
+        {{0, -1, 607, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 606
+        {{1, 0, 608, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 607
+        {{0, -1, 609, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 608
+        {{1, 0, 610, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 609
+        {{0, -1, 237, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 610
+        {{0, -1, 533, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 611
+        {{0, -1, 613, 49}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 612
+        {{0, -1, 614, 48}, {-1, 0, 228, 47}, {0, 0, 0, 0}},  // 613
+        {{-1, 0, 615, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 614
+        {{0, -1, 96, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 615
+        {{0, -1, 232, 47}, {-1, 0, 617, 47}, {0, 0, 0, 0}},  // 616
+        {{0, -1, 618, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 617
+        {{0, -1, 614, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 618
+        {{0, -1, 620, 48}, {-1, -1, 619, 35}, {-1, 0, 636, 47}},  // 619
+        {{-1, 0, 621, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 620
+        {{0, -1, 622, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 621
+        {{-1, 0, 623, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 622
+        {{0, -1, 624, 49}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 623
+        {{-1, 0, 625, 49}, {0, -1, 632, 49}, {0, 0, 0, 0}},  // 624
+        {{-1, 0, 626, 47}, {0, -1, 630, 49}, {0, 0, 0, 0}},  // 625
+        {{0, -1, 627, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 626
+        {{-1, 0, 628, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 627
+        {{-1, 0, 629, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 628
+        {{-1, 0, 205, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 629
+        {{0, -1, 225, 48}, {-1, 0, 631, 47}, {0, 0, 0, 0}},  // 630
+        {{0, -1, 151, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 631
+        {{0, -1, 633, 87}, {-1, 0, 617, 47}, {0, 0, 0, 0}},  // 632
+        {{1, 0, 634, 47}, {0, -1, 635, 32}, {0, 0, 0, 0}},  // 633
+        {{0, -1, 253, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 634
+        {{0, -1, 72, 25}, {1, 0, 234, 47}, {0, 0, 0, 0}},  // 635
+        {{0, -1, 637, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 636
+        {{-1, 0, 638, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 637
+        {{0, -1, 639, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 638
+        {{-1, 0, 640, 49}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 639
+        {{0, -1, 641, 49}, {-1, 0, 648, 49}, {0, 0, 0, 0}},  // 640
+        {{-1, 0, 642, 49}, {0, -1, 644, 48}, {0, 0, 0, 0}},  // 641
+        {{-1, 0, 144, 47}, {0, -1, 643, 48}, {0, 0, 0, 0}},  // 642
+        {{-1, 0, 617, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 643
+        {{-1, 0, 645, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 644
+        {{0, -1, 646, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 645
+        {{0, -1, 647, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 646
+        {{0, -1, 71, 25}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 647
+        {{-1, 0, 649, 88}, {0, -1, 151, 48}, {0, 0, 0, 0}},  // 648
+        {{-1, 0, 650, 41}, {0, 1, 651, 48}, {0, 0, 0, 0}},  // 649
+        {{-1, 0, 206, 40}, {0, 1, 158, 48}, {0, 0, 0, 0}},  // 650
+        {{-1, 0, 177, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 651
+        {{-1, 0, 653, 90}, {0, -1, 71, 25}, {0, 0, 0, 0}},  // 652
+        {{0, -1, 96, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 653
+        {{-1, 0, 655, 42}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 654
+        {{-1, 0, 125, 43}, {0, 1, 656, 40}, {0, 0, 0, 0}},  // 655
+        {{-1, 0, 657, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 656
+        {{0, 1, 658, 41}, {-1, 1, 186, 51}, {-1, 0, 162, 52}},  // 657
+        {{0, 1, 659, 41}, {-1, 0, 661, 51}, {0, 0, 0, 0}},  // 658
+        {{-1, 0, 660, 91}, {0, 1, 0, 0}, {0, 0, 0, 0}},  // 659
+        {{0, 1, 374, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 660
+        {{-1, 1, 186, 51}, {0, 1, 662, 75}, {-1, 0, 162, 52}},  // 661
+        {{-1, 0, 663, 52}, {0, 1, 375, 74}, {0, 0, 0, 0}},  // 662
+        {{0, 1, 664, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 663
+        {{-1, 0, 665, 52}, {0, 1, 364, 54}, {0, 0, 0, 0}},  // 664
+        {{0, 1, 666, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 665
+        {{0, 1, 667, 54}, {-1, 0, 438, 52}, {0, 0, 0, 0}},  // 666
+        {{-1, 0, 668, 52}, {0, 1, 365, 52}, {0, 0, 0, 0}},  // 667
+        {{0, 1, 669, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 668
+        {{-1, 0, 198, 52}, {0, 1, 372, 53}, {0, 0, 0, 0}},  // 669
+        {{-1, 0, 671, 42}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 670
+        {{-1, 0, 125, 43}, {0, 1, 672, 40}, {0, 0, 0, 0}},  // 671
+        {{-1, 0, 673, 91}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 672
+        {{0, 1, 674, 41}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 673
+        {{-1, 0, 675, 51}, {0, 1, 659, 41}, {0, 0, 0, 0}},  // 674
+        {{0, 1, 676, 75}, {-1, 0, 162, 52}, {-1, 1, 186, 51}},  // 675
+        {{0, 1, 375, 74}, {-1, 0, 360, 52}, {0, 0, 0, 0}},  // 676
+        {{-1, 0, 678, 36}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 677
+        {{-1, 0, 113, 37}, {0, -1, 679, 40}, {0, 0, 0, 0}},  // 678
+        {{-1, 0, 680, 90}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 679
+        {{0, -1, 681, 89}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 680
+        {{-1, 0, 682, 35}, {0, -1, 652, 89}, {0, 0, 0, 0}},  // 681
+        {{-1, 0, 137, 47}, {0, -1, 683, 27}, {-1, -1, 619, 35}},  // 682
+        {{0, -1, 80, 28}, {-1, 0, 684, 47}, {0, 0, 0, 0}},  // 683
+        {{0, -1, 685, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 684
+        {{-1, 0, 686, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 685
+        {{0, -1, 687, 49}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 686
+        {{-1, 0, 223, 47}, {0, -1, 616, 49}, {0, 0, 0, 0}},  // 687
+        {{-1, 0, 689, 90}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 688
+        {{0, -1, 679, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 689
+        {{-1, 0, 691, 91}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 690
+        {{0, 1, 672, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 691
+        {{-1, 0, 693, 90}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 692
+        {{0, -1, 694, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 693
+        {{-1, 0, 695, 90}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 694
+        {{0, -1, 696, 90}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 695
+        {{0, -1, 652, 89}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 696
+        {{-1, 0, 698, 91}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 697
+        {{0, 1, 699, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 698
+        {{-1, 0, 700, 91}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 699
+        {{0, 1, 701, 91}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 700
+        {{0, 1, 659, 41}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 701
+        {{0, 1, 703, 92}, {-1, 0, 370, 52}, {0, 0, 0, 0}},  // 702
+        {{1, 0, 704, 52}, {0, 1, 705, 4}, {0, 0, 0, 0}},  // 703
+        {{0, 1, 313, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 704
+        {{0, 1, 1, 0}, {1, 0, 367, 52}, {0, 0, 0, 0}},  // 705
+        {{0, 1, 707, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 706
+        {{-1, 0, 708, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 707
+        {{0, 1, 709, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 708
+        {{-1, 0, 710, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 709
+        {{-1, 0, 711, 54}, {0, 1, 715, 54}, {0, 0, 0, 0}},  // 710
+        {{-1, 0, 712, 93}, {0, 1, 173, 53}, {0, 0, 0, 0}},  // 711
+        {{-1, 0, 713, 89}, {0, -1, 714, 53}, {0, 0, 0, 0}},  // 712
+        {{-1, 0, 206, 40}, {0, -1, 170, 53}, {0, 0, 0, 0}},  // 713
+        {{-1, 0, 155, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 714
+        {{-1, 0, 716, 54}, {0, 1, 718, 53}, {0, 0, 0, 0}},  // 715
+        {{0, 1, 717, 53}, {-1, 0, 180, 52}, {0, 0, 0, 0}},  // 716
+        {{-1, 0, 370, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 717
+        {{-1, 0, 719, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 718
+        {{0, 1, 720, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 719
+        {{0, 1, 721, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 720
+        {{0, 1, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 721
+        {{-1, 0, 684, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 722
+        {{-1, 0, 724, 89}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 723
+        {{-1, 0, 725, 40}, {0, -1, 728, 44}, {0, 0, 0, 0}},  // 724
+        {{-1, 0, 726, 56}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 725
+        {{-1, 0, 727, 56}, {0, -1, 692, 40}, {0, 1, 697, 40}},  // 726
+        {{-1, 0, 210, 56}, {0, -1, 688, 40}, {0, 1, 670, 40}},  // 727
+        {{-1, 0, 729, 36}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 728
+        {{-1, 0, 113, 37}, {0, -1, 730, 44}, {0, 0, 0, 0}},  // 729
+        {{-1, 0, 731, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 730
+        {{0, -1, 96, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 731
+        {{-1, 0, 733, 42}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 732
+        {{0, 1, 734, 42}, {-1, 0, 741, 43}, {0, 0, 0, 0}},  // 733
+        {{-1, 0, 735, 51}, {0, 1, 740, 43}, {0, 0, 0, 0}},  // 734
+        {{-1, 0, 162, 52}, {0, 1, 736, 75}, {-1, 1, 186, 51}},  // 735
+        {{0, 1, 737, 42}, {-1, 0, 360, 52}, {0, 0, 0, 0}},  // 736
+        {{-1, 0, 376, 73}, {0, 1, 738, 94}, {0, 0, 0, 0}},  // 737
+        {{1, 0, 739, 43}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 738
+        {{0, 1, 313, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 739
+        {{0, 1, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 740
+        {{0, 1, 742, 43}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 741
+        {{0, 1, 743, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 742
+        {{-1, 0, 744, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 743
+        {{-1, 0, 745, 43}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 744
+        {{0, 1, 746, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 745
+        {{-1, 0, 747, 43}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 746
+        {{0, 1, 748, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 747
+        {{-1, 0, 177, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 748
+        {{-1, 0, 750, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 749
+        {{-1, 0, 751, 45}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 750
+        {{0, -1, 752, 44}, {-1, 0, 754, 44}, {0, 0, 0, 0}},  // 751
+        {{-1, 0, 753, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 752
+        {{0, -1, 730, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 753
+        {{-1, 0, 746, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 754
+        {{-1, 0, 756, 42}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 755
+        {{0, 1, 757, 44}, {-1, 0, 741, 43}, {0, 0, 0, 0}},  // 756
+        {{-1, 0, 758, 43}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 757
+        {{0, 1, 759, 43}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 758
+        {{0, 1, 760, 43}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 759
+        {{0, 1, 738, 94}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 760
+        {{-1, 0, 762, 95}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 761
+        {{0, 1, 374, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 762
+        {{-1, 0, 764, 56}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 763
+        {{-1, 0, 765, 56}, {0, -1, 692, 40}, {0, 1, 697, 40}},  // 764
+        {{-1, 0, 210, 56}, {0, -1, 766, 38}, {0, 1, 690, 40}},  // 765
+        {{-1, 0, 678, 36}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 766
+        {{-1, 0, 768, 95}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 767
+        {{0, 1, 769, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 768
+        {{-1, 0, 161, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 769
+        {{-1, 0, 771, 36}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 770
+        {{0, -1, 772, 36}, {-1, 0, 779, 37}, {0, 0, 0, 0}},  // 771
+        {{-1, 0, 773, 35}, {0, -1, 778, 37}, {0, 0, 0, 0}},  // 772
+        {{-1, 0, 137, 47}, {0, -1, 774, 27}, {-1, -1, 619, 35}},  // 773
+        {{0, -1, 775, 27}, {-1, 0, 684, 47}, {0, 0, 0, 0}},  // 774
+        {{-1, 0, 81, 29}, {0, -1, 776, 96}, {0, 0, 0, 0}},  // 775
+        {{1, 0, 777, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 776
+        {{0, -1, 253, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 777
+        {{0, -1, 71, 25}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 778
+        {{0, -1, 780, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 779
+        {{0, -1, 781, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 780
+        {{-1, 0, 782, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 781
+        {{-1, 0, 783, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 782
+        {{0, -1, 784, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 783
+        {{-1, 0, 785, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 784
+        {{0, -1, 786, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 785
+        {{-1, 0, 155, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 786
+        {{-1, 0, 788, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 787
+        {{-1, 0, 789, 39}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 788
+        {{0, 1, 790, 38}, {-1, 0, 792, 38}, {0, 0, 0, 0}},  // 789
+        {{-1, 0, 791, 95}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 790
+        {{0, 1, 761, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 791
+        {{-1, 0, 784, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 792
+        {{-1, 0, 794, 36}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 793
+        {{0, -1, 795, 38}, {-1, 0, 779, 37}, {0, 0, 0, 0}},  // 794
+        {{-1, 0, 796, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 795
+        {{0, -1, 797, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 796
+        {{0, -1, 798, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 797
+        {{0, -1, 776, 96}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 798
+        {{0, -1, 800, 63}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 799
+        {{1, 0, 271, 25}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 800
+        {{0, -1, 802, 61}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 801
+        {{0, -1, 254, 60}, {1, 0, 89, 29}, {0, 0, 0, 0}},  // 802
+        {{0, -1, 804, 31}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 803
+        {{1, 0, 805, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 804
+        {{0, -1, 237, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 805
+        {{0, -1, 807, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 806
+        {{-1, 0, 808, 27}, {0, -1, 815, 28}, {0, 0, 0, 0}},  // 807
+        {{0, -1, 809, 35}, {-1, 0, 814, 28}, {0, 0, 0, 0}},  // 808
+        {{-1, 0, 810, 36}, {0, -1, 722, 48}, {-1, -1, 619, 35}},  // 809
+        {{-1, 0, 811, 27}, {0, -1, 138, 48}, {0, 0, 0, 0}},  // 810
+        {{0, -1, 114, 38}, {-1, 0, 812, 97}, {0, 0, 0, 0}},  // 811
+        {{0, 1, 813, 28}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 812
+        {{-1, 0, 177, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 813
+        {{-1, 0, 205, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 814
+        {{-1, 0, 816, 28}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 815
+        {{-1, 0, 817, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 816
+        {{0, -1, 818, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 817
+        {{0, -1, 819, 28}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 818
+        {{-1, 0, 93, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 819
+        {{0, -1, 821, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 820
+        {{-1, 0, 822, 29}, {0, -1, 815, 28}, {0, 0, 0, 0}},  // 821
+        {{0, -1, 823, 28}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 822
+        {{-1, 0, 824, 28}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 823
+        {{-1, 0, 825, 28}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 824
+        {{-1, 0, 812, 97}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 825
+        {{0, -1, 827, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 826
+        {{0, -1, 722, 48}, {-1, 0, 828, 34}, {-1, -1, 619, 35}},  // 827
+        {{0, -1, 829, 35}, {-1, 0, 560, 34}, {0, 0, 0, 0}},  // 828
+        {{0, -1, 722, 48}, {-1, 0, 830, 36}, {-1, -1, 619, 35}},  // 829
+        {{-1, 0, 113, 37}, {0, -1, 831, 48}, {0, 0, 0, 0}},  // 830
+        {{-1, 0, 832, 49}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 831
+        {{0, -1, 833, 48}, {-1, 0, 150, 49}, {0, 0, 0, 0}},  // 832
+        {{-1, 0, 834, 49}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 833
+        {{0, -1, 142, 48}, {-1, 0, 835, 49}, {0, 0, 0, 0}},  // 834
+        {{0, -1, 836, 48}, {-1, 0, 156, 48}, {0, 0, 0, 0}},  // 835
+        {{-1, 0, 837, 49}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 836
+        {{-1, 0, 153, 47}, {0, -1, 147, 48}, {0, 0, 0, 0}},  // 837
+        {{0, -1, 839, 61}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 838
+        {{1, 0, 840, 25}, {0, -1, 254, 60}, {0, 0, 0, 0}},  // 839
+        {{0, -1, 841, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 840
+        {{1, 0, 842, 24}, {1, -1, 60, 21}, {0, -1, 238, 23}},  // 841
+        {{1, 0, 274, 32}, {0, -1, 843, 21}, {0, 0, 0, 0}},  // 842
+        {{1, 0, 844, 15}, {1, -1, 60, 21}, {0, -1, 238, 23}},  // 843
+        {{0, -1, 845, 23}, {1, 0, 41, 16}, {0, 0, 0, 0}},  // 844
+        {{1, 0, 846, 24}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 845
+        {{0, -1, 847, 23}, {1, 0, 545, 24}, {0, 0, 0, 0}},  // 846
+        {{1, 0, 848, 24}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 847
+        {{1, 0, 849, 24}, {0, -1, 537, 23}, {0, 0, 0, 0}},  // 848
+        {{0, -1, 850, 23}, {1, 0, 550, 23}, {0, 0, 0, 0}},  // 849
+        {{1, 0, 851, 24}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 850
+        {{1, 0, 548, 22}, {0, -1, 542, 23}, {0, 0, 0, 0}},  // 851
+        {{0, -1, 270, 61}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 852
+        {{1, 0, 539, 22}, {0, -1, 854, 23}, {0, 0, 0, 0}},  // 853
+        {{1, 0, 249, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 854
+        {{1, 0, 856, 98}, {0, -1, 546, 23}, {0, 0, 0, 0}},  // 855
+        {{0, 1, 857, 23}, {1, 0, 858, 19}, {0, 0, 0, 0}},  // 856
+        {{1, 0, 23, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 857
+        {{1, 0, 276, 12}, {0, 1, 552, 23}, {0, 0, 0, 0}},  // 858
+        {{1, 0, 860, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 859
+        {{0, -1, 861, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 860
+        {{1, 0, 862, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 861
+        {{0, -1, 863, 24}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 862
+        {{0, -1, 864, 24}, {1, 0, 868, 24}, {0, 0, 0, 0}},  // 863
+        {{0, -1, 865, 99}, {1, 0, 249, 22}, {0, 0, 0, 0}},  // 864
+        {{0, -1, 866, 34}, {-1, 0, 867, 22}, {0, 0, 0, 0}},  // 865
+        {{0, -1, 72, 25}, {-1, 0, 246, 22}, {0, 0, 0, 0}},  // 866
+        {{0, -1, 96, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 867
+        {{0, -1, 869, 24}, {1, 0, 871, 22}, {0, 0, 0, 0}},  // 868
+        {{0, -1, 605, 23}, {1, 0, 870, 22}, {0, 0, 0, 0}},  // 869
+        {{0, -1, 546, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 870
+        {{0, -1, 872, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 871
+        {{1, 0, 873, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 872
+        {{1, 0, 874, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 873
+        {{1, 0, 275, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 874
+        {{0, -1, 254, 60}, {1, 0, 239, 22}, {0, 0, 0, 0}},  // 875
+        {{1, 0, 877, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 876
+        {{1, 0, 24, 10}, {0, 1, 878, 17}, {0, 0, 0, 0}},  // 877
+        {{1, 0, 879, 100}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 878
+        {{0, 1, 313, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 879
+        {{1, 0, 881, 100}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 880
+        {{0, 1, 882, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 881
+        {{1, 0, 302, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 882
+        {{1, 0, 884, 15}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 883
+        {{1, 0, 885, 16}, {0, -1, 893, 15}, {0, 0, 0, 0}},  // 884
+        {{0, -1, 886, 16}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 885
+        {{0, -1, 887, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 886
+        {{1, 0, 888, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 887
+        {{1, 0, 889, 16}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 888
+        {{0, -1, 890, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 889
+        {{1, 0, 891, 16}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 890
+        {{0, -1, 892, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 891
+        {{1, 0, 91, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 892
+        {{0, -1, 894, 16}, {1, 0, 895, 21}, {0, 0, 0, 0}},  // 893
+        {{0, -1, 71, 25}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 894
+        {{1, -1, 60, 21}, {0, -1, 896, 61}, {1, 0, 611, 22}},  // 895
+        {{0, -1, 897, 15}, {1, 0, 239, 22}, {0, 0, 0, 0}},  // 896
+        {{1, 0, 255, 59}, {0, -1, 898, 101}, {0, 0, 0, 0}},  // 897
+        {{-1, 0, 899, 16}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 898
+        {{0, -1, 96, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 899
+        {{1, 0, 901, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 900
+        {{1, 0, 902, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 901
+        {{0, 1, 903, 17}, {1, 0, 905, 17}, {0, 0, 0, 0}},  // 902
+        {{1, 0, 904, 100}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 903
+        {{0, 1, 878, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 904
+        {{1, 0, 890, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 905
+        {{1, 0, 907, 15}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 906
+        {{0, -1, 908, 17}, {1, 0, 885, 16}, {0, 0, 0, 0}},  // 907
+        {{1, 0, 909, 16}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 908
+        {{0, -1, 910, 16}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 909
+        {{0, -1, 911, 16}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 910
+        {{0, -1, 898, 101}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 911
+        {{1, 0, 913, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 912
+        {{1, 0, 611, 22}, {1, -1, 60, 21}, {0, -1, 914, 13}},  // 913
+        {{1, 0, 915, 21}, {0, -1, 523, 13}, {0, 0, 0, 0}},  // 914
+        {{1, 0, 611, 22}, {1, -1, 60, 21}, {0, -1, 916, 61}},  // 915
+        {{0, -1, 254, 60}, {1, 0, 917, 22}, {0, 0, 0, 0}},  // 916
+        {{0, -1, 918, 24}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 917
+        {{1, 0, 919, 22}, {0, -1, 243, 24}, {0, 0, 0, 0}},  // 918
+        {{0, -1, 920, 24}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 919
+        {{0, -1, 921, 24}, {1, 0, 603, 22}, {0, 0, 0, 0}},  // 920
+        {{1, 0, 922, 22}, {0, -1, 244, 22}, {0, 0, 0, 0}},  // 921
+        {{0, -1, 923, 24}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 922
+        {{0, -1, 251, 23}, {1, 0, 608, 22}, {0, 0, 0, 0}},  // 923
+        {{1, 0, 925, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 924
+        {{0, 1, 926, 12}, {1, 0, 24, 10}, {0, 0, 0, 0}},  // 925
+        {{1, 0, 927, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 926
+        {{1, 0, 489, 8}, {1, 1, 288, 3}, {0, 1, 928, 7}},  // 927
+        {{1, 0, 929, 3}, {0, 1, 516, 19}, {0, 0, 0, 0}},  // 928
+        {{1, 0, 489, 8}, {0, 1, 930, 2}, {1, 1, 288, 3}},  // 929
+        {{0, 1, 314, 66}, {1, 0, 931, 8}, {0, 0, 0, 0}},  // 930
+        {{0, 1, 932, 7}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 931
+        {{1, 0, 933, 8}, {0, 1, 308, 7}, {0, 0, 0, 0}},  // 932
+        {{0, 1, 934, 7}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 933
+        {{0, 1, 935, 7}, {1, 0, 481, 8}, {0, 0, 0, 0}},  // 934
+        {{1, 0, 936, 8}, {0, 1, 476, 8}, {0, 0, 0, 0}},  // 935
+        {{0, 1, 937, 7}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 936
+        {{1, 0, 486, 8}, {0, 1, 311, 6}, {0, 0, 0, 0}},  // 937
+        {{1, 0, 939, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 938
+        {{1, 0, 24, 10}, {0, 1, 284, 12}, {0, 0, 0, 0}},  // 939
+        {{1, 0, 939, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 940
+        {{1, 0, 942, 15}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 941
+        {{1, 0, 41, 16}, {0, -1, 943, 9}, {0, 0, 0, 0}},  // 942
+        {{1, 0, 944, 102}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 943
+        {{0, -1, 253, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 944
+        {{1, 0, 946, 102}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 945
+        {{0, -1, 947, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 946
+        {{1, 0, 237, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 947
+        {{1, 0, 949, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 948
+        {{0, 1, 950, 5}, {1, 0, 957, 10}, {0, 0, 0, 0}},  // 949
+        {{1, 0, 951, 3}, {0, 1, 956, 10}, {0, 0, 0, 0}},  // 950
+        {{1, 1, 288, 3}, {0, 1, 952, 2}, {1, 0, 489, 8}},  // 951
+        {{0, 1, 953, 2}, {1, 0, 304, 8}, {0, 0, 0, 0}},  // 952
+        {{0, 1, 954, 103}, {1, 0, 315, 65}, {0, 0, 0, 0}},  // 953
+        {{-1, 0, 955, 10}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 954
+        {{0, 1, 374, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 955
+        {{0, 1, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 956
+        {{0, 1, 958, 10}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 957
+        {{0, 1, 959, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 958
+        {{1, 0, 960, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 959
+        {{1, 0, 961, 10}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 960
+        {{0, 1, 962, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 961
+        {{1, 0, 963, 10}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 962
+        {{0, 1, 964, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 963
+        {{1, 0, 23, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 964
+        {{1, 0, 966, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 965
+        {{1, 0, 967, 11}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 966
+        {{0, -1, 968, 9}, {1, 0, 970, 9}, {0, 0, 0, 0}},  // 967
+        {{1, 0, 969, 102}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 968
+        {{0, -1, 943, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 969
+        {{1, 0, 962, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 970
+        {{1, 0, 972, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 971
+        {{0, 1, 973, 9}, {1, 0, 957, 10}, {0, 0, 0, 0}},  // 972
+        {{1, 0, 974, 10}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 973
+        {{0, 1, 975, 10}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 974
+        {{0, 1, 976, 10}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 975
+        {{0, 1, 954, 103}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 976
+        {{0, 1, 978, 75}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 977
+        {{0, 1, 375, 74}, {-1, 0, 979, 0}, {0, 0, 0, 0}},  // 978
+        {{0, 1, 980, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 979
+        {{-1, 1, 186, 51}, {-1, 0, 981, 68}, {0, 1, 359, 53}},  // 980
+        {{-1, 0, 355, 68}, {0, 1, 982, 51}, {0, 0, 0, 0}},  // 981
+        {{-1, 1, 186, 51}, {-1, 0, 983, 42}, {0, 1, 359, 53}},  // 982
+        {{-1, 0, 125, 43}, {0, 1, 984, 53}, {0, 0, 0, 0}},  // 983
+        {{-1, 0, 985, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 984
+        {{0, 1, 986, 53}, {-1, 0, 167, 54}, {0, 0, 0, 0}},  // 985
+        {{-1, 0, 987, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 986
+        {{-1, 0, 988, 54}, {0, 1, 178, 53}, {0, 0, 0, 0}},  // 987
+        {{0, 1, 989, 53}, {-1, 0, 168, 53}, {0, 0, 0, 0}},  // 988
+        {{-1, 0, 990, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 989
+        {{-1, 0, 175, 52}, {0, 1, 183, 53}, {0, 0, 0, 0}}  // 990
+    };
+};
@@ -0,0 +1,520 @@
+/*
+Данный файл сгенерирован программой compile_data по data/main_types.txt (make generated_types) - не редактировать вручную.
+Таблица переходов графа типов для StaticTypesGraphParams (см. KC_static_types.hpp).
+*/
+
+#pragma once
+
+#include <cstdint>
+
+
+
+
+struct MainTypes {
+    struct Step {
+        int di, dj;
+        int type;
+        int info;
+    };
+
+    static constexpr const char *file = "data/main_types.txt";
+    static constexpr uint64_t checksum = 4581966424289923202ull;  // TypeInfo::checksum
+    static constexpr int theta_amount = 16;
+    static constexpr int types_amount = 384;
+    static constexpr int max_degree = 3;
+    static constexpr long double diagonal_cost = 1.41421356237000000002L;
+
+    static constexpr int start_type_by_theta[16] = {
+        0, 198, 211, 125, 122, 107, 137, 160, 276, 90, 55, 68, 306, 29, 9, 18
+    };
+    static constexpr uint32_t goal_mask_by_type[384] = {
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 16384, 0, 0, 0, 0, 0, 0,
+        0, 0, 32768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8192, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0,
+        0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0,
+        4096, 0, 0, 0, 2048, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 512, 0, 0, 0, 0, 0,
+        0, 0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0,
+        0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 16, 0, 0, 8, 0, 0,
+        0, 0, 0, 0, 0, 16, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0, 0,
+        128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+        0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+    };
+    static constexpr int goal_theta_by_type[384] = {
+        0, -1, -1, -1, -1, -1, -1, -1, -1, 14, -1, -1, -1, -1, -1, -1,
+        -1, -1, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 13, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 12, -1,
+        -1, -1, -1, -1, -1, -1, -1, 10, -1, -1, -1, -1, -1, -1, -1, -1,
+        12, -1, -1, -1, 11, -1, -1, -1, -1, -1, -1, -1, 12, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 9, -1, -1, -1, -1, -1,
+        -1, -1, 8, -1, -1, -1, -1, -1, -1, -1, -1, 5, -1, -1, -1, -1,
+        -1, -1, -1, 4, -1, -1, -1, -1, -1, -1, 4, -1, -1, 3, -1, -1,
+        -1, -1, -1, -1, -1, 4, -1, -1, -1, 6, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, 8, -1, -1, -1,
+        7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1,
+        -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 8,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1,
+        -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1, 12, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+    };
+    static constexpr int add_info_by_type[384] = {
+        0, 0, 0, 0, 1, 1, 0, 2, 0, 3, 4, 5, 6, 5, 6, 6,
+        7, 6, 8, 9, 8, 10, 8, 11, 8, 9, 9, 10, 9, 12, 13, 12,
+        14, 12, 15, 12, 13, 13, 14, 13, 13, 16, 13, 12, 12, 14, 17, 17,
+        18, 18, 19, 19, 18, 20, 18, 21, 22, 23, 24, 23, 24, 24, 25, 24,
+        26, 18, 24, 24, 27, 28, 27, 29, 28, 27, 27, 29, 26, 30, 27, 27,
+        31, 27, 27, 27, 32, 27, 28, 28, 29, 28, 33, 34, 33, 35, 34, 33,
+        33, 35, 36, 36, 37, 37, 38, 37, 39, 37, 39, 40, 41, 40, 42, 41,
+        40, 40, 42, 43, 43, 44, 44, 45, 45, 45, 44, 44, 44, 46, 47, 46,
+        48, 47, 46, 46, 48, 49, 46, 50, 46, 51, 52, 53, 54, 53, 54, 54,
+        55, 54, 54, 43, 54, 54, 53, 54, 53, 53, 55, 53, 56, 37, 53, 53,
+        57, 58, 57, 59, 57, 60, 57, 58, 58, 59, 58, 58, 61, 58, 57, 57,
+        59, 56, 62, 57, 57, 63, 57, 57, 51, 51, 51, 64, 46, 46, 46, 65,
+        46, 47, 47, 48, 47, 47, 66, 67, 66, 68, 66, 69, 66, 67, 67, 68,
+        67, 67, 70, 71, 72, 71, 71, 71, 73, 74, 73, 74, 74, 75, 74, 49,
+        74, 74, 74, 73, 74, 73, 73, 75, 73, 76, 73, 73, 67, 66, 66, 68,
+        66, 76, 76, 66, 66, 77, 66, 78, 44, 44, 79, 44, 44, 80, 44, 44,
+        79, 44, 79, 44, 80, 44, 80, 40, 40, 81, 40, 40, 40, 82, 83, 40,
+        41, 41, 42, 41, 37, 41, 37, 84, 37, 84, 38, 38, 37, 37, 37, 39,
+        37, 37, 84, 37, 33, 33, 85, 33, 33, 33, 86, 87, 33, 34, 34, 35,
+        34, 34, 18, 28, 88, 21, 21, 21, 24, 23, 24, 23, 23, 25, 23, 36,
+        23, 23, 19, 18, 18, 18, 89, 18, 18, 20, 18, 20, 18, 89, 18, 89,
+        12, 12, 90, 12, 12, 9, 91, 9, 8, 8, 10, 8, 92, 92, 8, 8,
+        93, 8, 6, 92, 6, 6, 5, 6, 5, 5, 7, 5, 17, 5, 5, 3,
+        3, 3, 0, 94, 0, 1, 0, 0, 0, 2, 0, 2, 0, 94, 0, 94
+    };
+    static constexpr int degree_by_type[384] = {
+        1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1,
+        2, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 2, 1, 1, 1, 1,
+        2, 1, 2, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 2, 2, 2,
+        1, 1, 3, 3, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 2, 1,
+        2, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 2, 2, 2, 1, 1,
+        1, 1, 1, 1, 2, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1, 1,
+        1, 2, 2, 2, 1, 1, 3, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+        1, 1, 2, 2, 2, 1, 1, 3, 3, 3, 1, 1, 1, 1, 1, 1,
+        2, 1, 1, 1, 2, 2, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1,
+        2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1,
+        1, 1, 1, 2, 1, 2, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1,
+        2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 2,
+        1, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 2,
+        1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2,
+        1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2,
+        1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1,
+        1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 3, 3, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2,
+        1, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 1, 1,
+        1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1,
+        1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+    };
+    static constexpr Step succ[384][3] = {
+        {{0, 1, 1, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 0
+        {{0, 1, 2, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 1
+        {{0, 1, 3, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 2
+        {{0, 1, 4, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 3
+        {{0, 1, 5, 1}, {-1, 0, 376, 0}, {1, 0, 380, 0}},  // 4
+        {{-1, 0, 6, 0}, {1, 0, 370, 0}, {0, 1, 373, 1}},  // 5
+        {{0, 1, 7, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 6
+        {{-1, 0, 8, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 7
+        {{0, 1, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 8
+        {{-1, 1, 10, 4}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 9
+        {{0, 1, 11, 5}, {-1, 0, 357, 6}, {-1, 1, 367, 3}},  // 10
+        {{-1, 0, 12, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 11
+        {{0, 1, 13, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 12
+        {{-1, 0, 14, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 13
+        {{0, 1, 15, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 14
+        {{0, 1, 16, 7}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 15
+        {{-1, 0, 17, 6}, {0, 1, 354, 6}, {0, 0, 0, 0}},  // 16
+        {{0, 1, 18, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 17
+        {{0, 1, 19, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 18
+        {{-1, 0, 20, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 19
+        {{0, 1, 21, 10}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 20
+        {{-1, 0, 22, 8}, {0, 1, 343, 9}, {0, 0, 0, 0}},  // 21
+        {{0, 1, 23, 11}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 22
+        {{-1, 0, 24, 8}, {-1, 1, 342, 91}, {0, 0, 0, 0}},  // 23
+        {{0, 1, 25, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 24
+        {{-1, 0, 26, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 25
+        {{-1, 0, 27, 10}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 26
+        {{0, 1, 28, 9}, {-1, 0, 341, 9}, {0, 0, 0, 0}},  // 27
+        {{-1, 0, 29, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 28
+        {{-1, 0, 30, 13}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 29
+        {{0, 1, 31, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 30
+        {{-1, 0, 32, 14}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 31
+        {{0, 1, 33, 12}, {-1, 0, 42, 13}, {0, 0, 0, 0}},  // 32
+        {{-1, 0, 34, 15}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 33
+        {{0, 1, 35, 12}, {-1, 1, 41, 16}, {0, 0, 0, 0}},  // 34
+        {{-1, 0, 36, 13}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 35
+        {{0, 1, 37, 13}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 36
+        {{0, 1, 38, 14}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 37
+        {{0, 1, 39, 13}, {-1, 0, 40, 13}, {0, 0, 0, 0}},  // 38
+        {{0, 1, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 39
+        {{0, 1, 18, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 40
+        {{-1, 1, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 41
+        {{0, 1, 43, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 42
+        {{-1, 0, 44, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 43
+        {{-1, 0, 45, 14}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 44
+        {{-1, 0, 46, 17}, {0, 1, 340, 12}, {0, 0, 0, 0}},  // 45
+        {{-1, 0, 47, 17}, {0, -1, 337, 12}, {0, 0, 0, 0}},  // 46
+        {{-1, 0, 48, 18}, {0, -1, 336, 12}, {0, 0, 0, 0}},  // 47
+        {{-1, 0, 49, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 48
+        {{-1, 0, 50, 19}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 49
+        {{-1, 0, 51, 19}, {0, -1, 328, 18}, {0, 1, 332, 18}},  // 50
+        {{0, -1, 52, 18}, {-1, 0, 322, 19}, {0, 1, 325, 18}},  // 51
+        {{-1, 0, 53, 20}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 52
+        {{0, -1, 54, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 53
+        {{-1, 0, 55, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 54
+        {{-1, -1, 56, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 55
+        {{-1, 0, 57, 23}, {-1, -1, 309, 21}, {0, -1, 312, 24}},  // 56
+        {{0, -1, 58, 24}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 57
+        {{-1, 0, 59, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 58
+        {{0, -1, 60, 24}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 59
+        {{-1, 0, 61, 24}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 60
+        {{-1, 0, 62, 25}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 61
+        {{-1, 0, 63, 24}, {0, -1, 67, 24}, {0, 0, 0, 0}},  // 62
+        {{-1, 0, 64, 26}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 63
+        {{-1, 0, 65, 18}, {0, 1, 66, 24}, {0, 0, 0, 0}},  // 64
+        {{-1, 0, 48, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 65
+        {{-1, 0, 29, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 66
+        {{-1, 0, 68, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 67
+        {{-1, 0, 69, 28}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 68
+        {{0, -1, 70, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 69
+        {{-1, 0, 71, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 70
+        {{-1, 0, 72, 28}, {0, -1, 83, 27}, {0, 0, 0, 0}},  // 71
+        {{0, -1, 73, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 72
+        {{-1, 0, 74, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 73
+        {{-1, 0, 75, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 74
+        {{-1, 0, 76, 26}, {0, -1, 82, 27}, {0, 0, 0, 0}},  // 75
+        {{-1, 0, 77, 30}, {0, 1, 79, 27}, {0, 0, 0, 0}},  // 76
+        {{-1, 0, 48, 18}, {0, 1, 78, 27}, {0, 0, 0, 0}},  // 77
+        {{-1, 0, 29, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 78
+        {{-1, 0, 80, 31}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 79
+        {{0, 1, 81, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 80
+        {{-1, 0, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 81
+        {{-1, 0, 68, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 82
+        {{-1, 0, 84, 32}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 83
+        {{0, -1, 85, 27}, {-1, -1, 308, 88}, {0, 0, 0, 0}},  // 84
+        {{-1, 0, 86, 28}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 85
+        {{0, -1, 87, 28}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 86
+        {{0, -1, 88, 29}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 87
+        {{-1, 0, 89, 28}, {0, -1, 307, 28}, {0, 0, 0, 0}},  // 88
+        {{0, -1, 90, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 89
+        {{0, -1, 91, 34}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 90
+        {{-1, 0, 92, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 91
+        {{0, -1, 93, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 92
+        {{0, -1, 94, 34}, {-1, 0, 297, 33}, {0, 0, 0, 0}},  // 93
+        {{-1, 0, 95, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 94
+        {{0, -1, 96, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 95
+        {{0, -1, 97, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 96
+        {{0, -1, 98, 36}, {-1, 0, 296, 33}, {0, 0, 0, 0}},  // 97
+        {{0, -1, 99, 36}, {1, 0, 293, 33}, {0, 0, 0, 0}},  // 98
+        {{0, -1, 100, 37}, {1, 0, 292, 33}, {0, 0, 0, 0}},  // 99
+        {{0, -1, 101, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 100
+        {{0, -1, 102, 38}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 101
+        {{1, 0, 103, 37}, {-1, 0, 278, 37}, {0, -1, 282, 38}},  // 102
+        {{0, -1, 104, 39}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 103
+        {{1, 0, 105, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 104
+        {{0, -1, 106, 39}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 105
+        {{1, 0, 107, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 106
+        {{1, 0, 108, 41}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 107
+        {{0, -1, 109, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 108
+        {{1, 0, 110, 42}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 109
+        {{1, 0, 111, 41}, {0, -1, 268, 40}, {0, 0, 0, 0}},  // 110
+        {{0, -1, 112, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 111
+        {{1, 0, 113, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 112
+        {{1, 0, 114, 42}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 113
+        {{1, 0, 115, 43}, {0, -1, 267, 40}, {0, 0, 0, 0}},  // 114
+        {{1, 0, 116, 43}, {0, 1, 264, 40}, {0, 0, 0, 0}},  // 115
+        {{1, 0, 117, 44}, {0, 1, 263, 40}, {0, 0, 0, 0}},  // 116
+        {{1, 0, 118, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 117
+        {{1, 0, 119, 45}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 118
+        {{1, 0, 120, 45}, {0, -1, 255, 44}, {0, 1, 259, 44}},  // 119
+        {{1, 0, 121, 45}, {0, -1, 249, 44}, {0, 1, 252, 44}},  // 120
+        {{1, 0, 122, 44}, {0, 1, 124, 44}, {0, -1, 248, 44}},  // 121
+        {{1, 0, 123, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 122
+        {{1, 0, 117, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 123
+        {{1, 0, 125, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 124
+        {{1, 0, 126, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 125
+        {{0, 1, 127, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 126
+        {{1, 0, 128, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 127
+        {{1, 0, 129, 47}, {0, 1, 190, 46}, {0, 0, 0, 0}},  // 128
+        {{0, 1, 130, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 129
+        {{1, 0, 131, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 130
+        {{1, 0, 132, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 131
+        {{1, 0, 133, 49}, {0, 1, 189, 46}, {0, 0, 0, 0}},  // 132
+        {{0, -1, 134, 46}, {1, 0, 187, 64}, {0, 0, 0, 0}},  // 133
+        {{1, 0, 135, 50}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 134
+        {{0, -1, 136, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 135
+        {{1, 0, 137, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 136
+        {{1, -1, 138, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 137
+        {{1, 0, 139, 53}, {0, -1, 149, 54}, {1, -1, 184, 51}},  // 138
+        {{0, -1, 140, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 139
+        {{1, 0, 141, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 140
+        {{0, -1, 142, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 141
+        {{1, 0, 143, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 142
+        {{1, 0, 144, 55}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 143
+        {{0, -1, 145, 54}, {1, 0, 146, 54}, {0, 0, 0, 0}},  // 144
+        {{1, 0, 107, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 145
+        {{1, 0, 147, 43}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 146
+        {{1, 0, 123, 44}, {0, 1, 148, 54}, {0, 0, 0, 0}},  // 147
+        {{1, 0, 125, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 148
+        {{1, 0, 150, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 149
+        {{0, -1, 151, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 150
+        {{1, 0, 152, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 151
+        {{0, -1, 153, 53}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 152
+        {{0, -1, 154, 55}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 153
+        {{0, -1, 155, 53}, {1, 0, 159, 53}, {0, 0, 0, 0}},  // 154
+        {{0, -1, 156, 56}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 155
+        {{0, -1, 157, 37}, {-1, 0, 158, 53}, {0, 0, 0, 0}},  // 156
+        {{0, -1, 100, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 157
+        {{0, -1, 90, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 158
+        {{0, -1, 160, 57}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 159
+        {{0, -1, 161, 58}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 160
+        {{1, 0, 162, 57}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 161
+        {{0, -1, 163, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 162
+        {{1, 0, 164, 57}, {0, -1, 173, 58}, {0, 0, 0, 0}},  // 163
+        {{0, -1, 165, 60}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 164
+        {{1, 0, 166, 57}, {1, -1, 172, 61}, {0, 0, 0, 0}},  // 165
+        {{0, -1, 167, 58}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 166
+        {{1, 0, 168, 58}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 167
+        {{1, 0, 169, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 168
+        {{1, 0, 170, 58}, {0, -1, 171, 58}, {0, 0, 0, 0}},  // 169
+        {{1, 0, 122, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 170
+        {{1, 0, 107, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 171
+        {{1, -1, 137, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 172
+        {{1, 0, 174, 57}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 173
+        {{0, -1, 175, 57}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 174
+        {{0, -1, 176, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 175
+        {{0, -1, 177, 56}, {1, 0, 183, 57}, {0, 0, 0, 0}},  // 176
+        {{0, -1, 178, 62}, {-1, 0, 180, 57}, {0, 0, 0, 0}},  // 177
+        {{0, -1, 100, 37}, {-1, 0, 179, 57}, {0, 0, 0, 0}},  // 178
+        {{0, -1, 90, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 179
+        {{0, -1, 181, 63}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 180
+        {{-1, 0, 182, 57}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 181
+        {{0, -1, 55, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 182
+        {{0, -1, 160, 57}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 183
+        {{1, -1, 185, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 184
+        {{1, -1, 186, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 185
+        {{1, -1, 137, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 186
+        {{1, 0, 117, 44}, {0, -1, 188, 46}, {0, 0, 0, 0}},  // 187
+        {{1, 0, 107, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 188
+        {{1, 0, 125, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 189
+        {{1, 0, 191, 65}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 190
+        {{0, 1, 192, 46}, {1, 1, 247, 78}, {0, 0, 0, 0}},  // 191
+        {{1, 0, 193, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 192
+        {{0, 1, 194, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 193
+        {{0, 1, 195, 48}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 194
+        {{0, 1, 196, 47}, {1, 0, 197, 47}, {0, 0, 0, 0}},  // 195
+        {{0, 1, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 196
+        {{0, 1, 198, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 197
+        {{0, 1, 199, 67}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 198
+        {{1, 0, 200, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 199
+        {{0, 1, 201, 68}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 200
+        {{1, 0, 202, 66}, {0, 1, 236, 67}, {0, 0, 0, 0}},  // 201
+        {{0, 1, 203, 69}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 202
+        {{1, 0, 204, 66}, {1, 1, 210, 70}, {0, 0, 0, 0}},  // 203
+        {{0, 1, 205, 67}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 204
+        {{1, 0, 206, 67}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 205
+        {{1, 0, 207, 68}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 206
+        {{1, 0, 208, 67}, {0, 1, 209, 67}, {0, 0, 0, 0}},  // 207
+        {{1, 0, 122, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 208
+        {{1, 0, 125, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 209
+        {{1, 1, 211, 71}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 210
+        {{1, 1, 212, 72}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 211
+        {{1, 1, 213, 71}, {1, 0, 216, 73}, {0, 1, 226, 74}},  // 212
+        {{1, 1, 214, 71}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 213
+        {{1, 1, 215, 71}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 214
+        {{1, 1, 211, 71}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 215
+        {{0, 1, 217, 74}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 216
+        {{1, 0, 218, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 217
+        {{0, 1, 219, 74}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 218
+        {{1, 0, 220, 74}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 219
+        {{1, 0, 221, 75}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 220
+        {{1, 0, 222, 74}, {0, 1, 225, 74}, {0, 0, 0, 0}},  // 221
+        {{1, 0, 223, 49}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 222
+        {{1, 0, 123, 44}, {0, -1, 224, 74}, {0, 0, 0, 0}},  // 223
+        {{1, 0, 107, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 224
+        {{1, 0, 125, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 225
+        {{1, 0, 227, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 226
+        {{0, 1, 228, 74}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 227
+        {{1, 0, 229, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 228
+        {{0, 1, 230, 73}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 229
+        {{0, 1, 231, 75}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 230
+        {{0, 1, 232, 73}, {1, 0, 235, 73}, {0, 0, 0, 0}},  // 231
+        {{0, 1, 233, 76}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 232
+        {{0, 1, 1, 0}, {-1, 0, 234, 73}, {0, 0, 0, 0}},  // 233
+        {{0, 1, 18, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 234
+        {{0, 1, 198, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 235
+        {{1, 0, 237, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 236
+        {{0, 1, 238, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 237
+        {{0, 1, 239, 68}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 238
+        {{1, 0, 240, 66}, {0, 1, 241, 76}, {0, 0, 0, 0}},  // 239
+        {{0, 1, 198, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 240
+        {{0, 1, 242, 76}, {-1, 0, 244, 66}, {0, 0, 0, 0}},  // 241
+        {{0, 1, 2, 0}, {-1, 0, 243, 66}, {0, 0, 0, 0}},  // 242
+        {{0, 1, 18, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 243
+        {{0, 1, 245, 77}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 244
+        {{-1, 0, 246, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 245
+        {{0, 1, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 246
+        {{1, 1, 211, 71}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 247
+        {{1, 0, 107, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 248
+        {{1, 0, 250, 79}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 249
+        {{0, -1, 251, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 250
+        {{1, 0, 137, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 251
+        {{1, 0, 253, 80}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 252
+        {{0, 1, 254, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 253
+        {{1, 0, 211, 71}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 254
+        {{1, 0, 256, 79}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 255
+        {{0, -1, 257, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 256
+        {{1, 0, 258, 79}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 257
+        {{0, -1, 160, 57}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 258
+        {{1, 0, 260, 80}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 259
+        {{0, 1, 261, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 260
+        {{1, 0, 262, 80}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 261
+        {{0, 1, 198, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 262
+        {{1, 0, 125, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 263
+        {{1, 0, 265, 81}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 264
+        {{0, 1, 266, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 265
+        {{1, 0, 211, 71}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 266
+        {{1, 0, 107, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 267
+        {{1, 0, 269, 82}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 268
+        {{1, -1, 270, 83}, {0, -1, 271, 40}, {0, 0, 0, 0}},  // 269
+        {{1, -1, 137, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 270
+        {{1, 0, 272, 41}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 271
+        {{0, -1, 273, 41}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 272
+        {{0, -1, 274, 42}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 273
+        {{0, -1, 275, 41}, {1, 0, 277, 41}, {0, 0, 0, 0}},  // 274
+        {{0, -1, 276, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 275
+        {{0, -1, 157, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 276
+        {{0, -1, 160, 57}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 277
+        {{0, -1, 279, 84}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 278
+        {{-1, 0, 280, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 279
+        {{0, -1, 281, 84}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 280
+        {{-1, 0, 68, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 281
+        {{0, -1, 283, 38}, {1, 0, 286, 37}, {-1, 0, 289, 37}},  // 282
+        {{0, -1, 276, 37}, {-1, 0, 284, 37}, {1, 0, 285, 37}},  // 283
+        {{0, -1, 90, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 284
+        {{0, -1, 160, 57}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 285
+        {{0, -1, 287, 39}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 286
+        {{1, 0, 288, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 287
+        {{0, -1, 137, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 288
+        {{0, -1, 290, 84}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 289
+        {{-1, 0, 291, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 290
+        {{0, -1, 55, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 291
+        {{0, -1, 160, 57}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 292
+        {{0, -1, 294, 85}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 293
+        {{1, 0, 295, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 294
+        {{0, -1, 137, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 295
+        {{0, -1, 90, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 296
+        {{0, -1, 298, 86}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 297
+        {{-1, -1, 299, 87}, {-1, 0, 300, 33}, {0, 0, 0, 0}},  // 298
+        {{-1, -1, 55, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 299
+        {{0, -1, 301, 34}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 300
+        {{-1, 0, 302, 34}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 301
+        {{-1, 0, 303, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 302
+        {{0, -1, 304, 34}, {-1, 0, 305, 34}, {0, 0, 0, 0}},  // 303
+        {{-1, 0, 68, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 304
+        {{-1, 0, 306, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 305
+        {{-1, 0, 65, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 306
+        {{0, -1, 276, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 307
+        {{-1, -1, 55, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 308
+        {{-1, -1, 310, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 309
+        {{-1, -1, 311, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 310
+        {{-1, -1, 55, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 311
+        {{-1, 0, 313, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 312
+        {{0, -1, 314, 24}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 313
+        {{-1, 0, 315, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 314
+        {{0, -1, 316, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 315
+        {{0, -1, 317, 25}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 316
+        {{0, -1, 318, 23}, {-1, 0, 321, 23}, {0, 0, 0, 0}},  // 317
+        {{0, -1, 319, 36}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 318
+        {{0, -1, 157, 37}, {1, 0, 320, 23}, {0, 0, 0, 0}},  // 319
+        {{0, -1, 160, 57}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 320
+        {{0, -1, 90, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 321
+        {{0, -1, 323, 18}, {0, 1, 324, 18}, {-1, 0, 306, 18}},  // 322
+        {{-1, 0, 68, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 323
+        {{-1, 0, 29, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 324
+        {{-1, 0, 326, 89}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 325
+        {{0, 1, 327, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 326
+        {{-1, 0, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 327
+        {{-1, 0, 329, 20}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 328
+        {{0, -1, 330, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 329
+        {{-1, 0, 331, 20}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 330
+        {{0, -1, 90, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 331
+        {{-1, 0, 333, 89}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 332
+        {{0, 1, 334, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 333
+        {{-1, 0, 335, 89}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 334
+        {{0, 1, 18, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 335
+        {{-1, 0, 68, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 336
+        {{-1, 0, 338, 90}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 337
+        {{0, -1, 339, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 338
+        {{-1, 0, 55, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 339
+        {{-1, 0, 29, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 340
+        {{-1, 0, 306, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 341
+        {{-1, 1, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 342
+        {{-1, 0, 344, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 343
+        {{0, 1, 345, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 344
+        {{0, 1, 346, 10}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 345
+        {{-1, 0, 347, 8}, {0, 1, 348, 92}, {0, 0, 0, 0}},  // 346
+        {{0, 1, 18, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 347
+        {{0, 1, 349, 92}, {1, 0, 351, 8}, {0, 0, 0, 0}},  // 348
+        {{0, 1, 2, 0}, {1, 0, 350, 8}, {0, 0, 0, 0}},  // 349
+        {{0, 1, 198, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 350
+        {{0, 1, 352, 93}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 351
+        {{1, 0, 353, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 352
+        {{0, 1, 211, 71}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 353
+        {{0, 1, 355, 92}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 354
+        {{0, 1, 1, 0}, {1, 0, 356, 6}, {0, 0, 0, 0}},  // 355
+        {{0, 1, 198, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 356
+        {{0, 1, 358, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 357
+        {{-1, 0, 359, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 358
+        {{0, 1, 360, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 359
+        {{-1, 0, 361, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 360
+        {{-1, 0, 362, 7}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 361
+        {{-1, 0, 363, 5}, {0, 1, 366, 5}, {0, 0, 0, 0}},  // 362
+        {{-1, 0, 364, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 363
+        {{-1, 0, 65, 18}, {0, -1, 365, 5}, {0, 0, 0, 0}},  // 364
+        {{-1, 0, 68, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 365
+        {{-1, 0, 29, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 366
+        {{-1, 1, 368, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 367
+        {{-1, 1, 369, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 368
+        {{-1, 1, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 369
+        {{0, 1, 371, 94}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 370
+        {{1, 0, 372, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 371
+        {{0, 1, 211, 71}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 372
+        {{1, 0, 374, 0}, {-1, 0, 375, 0}, {0, 1, 0, 0}},  // 373
+        {{0, 1, 198, 66}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 374
+        {{0, 1, 18, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 375
+        {{0, 1, 377, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 376
+        {{-1, 0, 378, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 377
+        {{0, 1, 379, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 378
+        {{-1, 0, 29, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 379
+        {{0, 1, 381, 94}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 380
+        {{1, 0, 382, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 381
+        {{0, 1, 383, 94}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 382
+        {{1, 0, 125, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}}  // 383
+    };
+};
@@ -0,0 +1,256 @@
+/*
+Данный файл сгенерирован программой compile_data по data/short_types.txt (make generated_types) - не редактировать вручную.
+Таблица переходов графа типов для StaticTypesGraphParams (см. KC_static_types.hpp).
+*/
+
+#pragma once
+
+#include <cstdint>
+
+
+
+
+struct ShortTypes {
+    struct Step {
+        int di, dj;
+        int type;
+        int info;
+    };
+
+    static constexpr const char *file = "data/short_types.txt";
+    static constexpr uint64_t checksum = 1370350307051595220ull;  // TypeInfo::checksum
+    static constexpr int theta_amount = 16;
+    static constexpr int types_amount = 172;
+    static constexpr int max_degree = 3;
+    static constexpr long double diagonal_cost = 1.41421356237000000002L;
+
+    static constexpr int start_type_by_theta[16] = {
+        0, 73, 49, 46, 113, 40, 23, 104, 145, 18, 88, 13, 82, 80, 66, 62
+    };
+    static constexpr uint32_t goal_mask_by_type[172] = {
+        1, 1, 1, 0, 49152, 8192, 0, 8192, 4096, 0, 8192, 4096, 0, 2048, 0, 0,
+        0, 0, 512, 0, 0, 512, 0, 64, 0, 0, 32, 16, 16, 16, 0, 12,
+        0, 0, 8, 16, 0, 8, 16, 0, 32, 0, 0, 32, 16, 0, 8, 0,
+        0, 4, 0, 0, 8, 0, 0, 0, 2, 1, 0, 2, 1, 0, 32768, 0,
+        0, 32768, 16384, 0, 0, 0, 32768, 1, 0, 2, 0, 1, 0, 0, 0, 0,
+        8192, 0, 4096, 4096, 4096, 0, 24576, 0, 1024, 0, 0, 512, 256, 256, 256, 0,
+        1536, 2048, 0, 2048, 4096, 0, 256, 0, 128, 0, 0, 128, 256, 0, 0, 0,
+        0, 16, 0, 0, 0, 192, 32, 0, 0, 128, 256, 0, 0, 0, 0, 0,
+        0, 0, 32768, 0, 3072, 0, 0, 2048, 0, 512, 0, 0, 0, 0, 0, 0,
+        0, 256, 0, 0, 0, 0, 2, 0, 96, 128, 0, 128, 0, 0, 0, 0,
+        2048, 4096, 0, 0, 0, 0, 32768, 0, 6, 8, 0, 0
+    };
+    static constexpr int goal_theta_by_type[172] = {
+        0, 0, 0, -1, -2, 13, -1, 13, 12, -1, 13, 12, -1, 11, -1, -1,
+        -1, -1, 9, -1, -1, 9, -1, 6, -1, -1, 5, 4, 4, 4, -1, -2,
+        -1, -1, 3, 4, -1, 3, 4, -1, 5, -1, -1, 5, 4, -1, 3, -1,
+        -1, 2, -1, -1, 3, -1, -1, -1, 1, 0, -1, 1, 0, -1, 15, -1,
+        -1, 15, 14, -1, -1, -1, 15, 0, -1, 1, -1, 0, -1, -1, -1, -1,
+        13, -1, 12, 12, 12, -1, -2, -1, 10, -1, -1, 9, 8, 8, 8, -1,
+        -2, 11, -1, 11, 12, -1, 8, -1, 7, -1, -1, 7, 8, -1, -1, -1,
+        -1, 4, -1, -1, -1, -2, 5, -1, -1, 7, 8, -1, -1, -1, -1, -1,
+        -1, -1, 15, -1, -2, -1, -1, 11, -1, 9, -1, -1, -1, -1, -1, -1,
+        -1, 8, -1, -1, -1, -1, 1, -1, -2, 7, -1, 7, -1, -1, -1, -1,
+        11, 12, -1, -1, -1, -1, 15, -1, -2, 3, -1, -1
+    };
+    static constexpr int add_info_by_type[172] = {
+        0, 1, 1, 0, 2, 3, 4, 5, 6, 3, 7, 6, 5, 8, 9, 10,
+        10, 9, 11, 12, 13, 14, 11, 15, 16, 17, 18, 19, 19, 19, 20, 21,
+        22, 23, 24, 19, 25, 24, 19, 26, 18, 27, 28, 29, 19, 18, 26, 30,
+        18, 21, 22, 31, 26, 31, 31, 22, 32, 1, 33, 34, 1, 32, 35, 36,
+        37, 38, 2, 39, 4, 39, 35, 1, 39, 32, 40, 1, 35, 35, 37, 36,
+        5, 41, 42, 6, 6, 42, 43, 5, 44, 45, 46, 11, 47, 47, 47, 48,
+        49, 10, 45, 8, 6, 45, 47, 11, 50, 51, 52, 53, 47, 50, 50, 52,
+        51, 20, 13, 12, 48, 15, 28, 17, 54, 53, 47, 16, 48, 48, 46, 46,
+        3, 41, 37, 42, 44, 46, 55, 56, 8, 13, 42, 42, 32, 33, 40, 22,
+        28, 48, 27, 26, 25, 30, 33, 20, 57, 52, 16, 50, 20, 20, 17, 17,
+        56, 6, 8, 4, 4, 58, 38, 0, 59, 25, 0, 0
+    };
+    static constexpr int degree_by_type[172] = {
+        1, 3, 3, 1, 3, 2, 1, 1, 3, 2, 3, 3, 1, 1, 1, 2,
+        2, 1, 1, 1, 2, 3, 1, 3, 1, 1, 1, 3, 3, 3, 1, 3,
+        1, 2, 3, 3, 2, 3, 3, 1, 1, 1, 2, 3, 3, 1, 1, 1,
+        1, 3, 1, 1, 1, 1, 1, 1, 1, 3, 2, 3, 3, 1, 1, 1,
+        2, 3, 3, 1, 1, 1, 1, 3, 1, 1, 1, 3, 1, 1, 2, 1,
+        1, 1, 1, 3, 3, 1, 3, 1, 3, 1, 1, 1, 3, 3, 3, 1,
+        3, 2, 1, 1, 3, 1, 3, 1, 1, 1, 2, 3, 3, 1, 1, 2,
+        1, 1, 2, 1, 1, 3, 2, 1, 2, 3, 3, 1, 1, 1, 1, 1,
+        2, 1, 2, 1, 3, 1, 2, 3, 1, 2, 1, 1, 1, 2, 1, 1,
+        2, 1, 1, 1, 2, 1, 2, 1, 3, 2, 1, 1, 1, 1, 1, 1,
+        3, 3, 1, 1, 1, 2, 3, 1, 3, 2, 1, 1
+    };
+    static constexpr Step succ[172][3] = {
+        {{0, 1, 1, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 0
+        {{0, 1, 2, 1}, {-1, 0, 170, 0}, {1, 0, 171, 0}},  // 1
+        {{0, 1, 2, 1}, {-1, 0, 3, 0}, {1, 0, 167, 0}},  // 2
+        {{0, 1, 4, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 3
+        {{-1, 0, 5, 3}, {0, 1, 164, 4}, {-1, 1, 66, 2}},  // 4
+        {{0, 1, 6, 4}, {-1, 0, 81, 41}, {0, 0, 0, 0}},  // 5
+        {{-1, 0, 7, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 6
+        {{-1, 0, 8, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 7
+        {{0, 1, 9, 3}, {-1, 0, 83, 6}, {0, -1, 163, 4}},  // 8
+        {{-1, 0, 10, 7}, {0, 1, 128, 3}, {0, 0, 0, 0}},  // 9
+        {{-1, 0, 11, 6}, {0, 1, 66, 2}, {0, -1, 87, 5}},  // 10
+        {{0, 1, 9, 3}, {0, -1, 12, 5}, {-1, 0, 83, 6}},  // 11
+        {{-1, 0, 13, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 12
+        {{-1, 0, 14, 9}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 13
+        {{0, -1, 15, 10}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 14
+        {{0, -1, 16, 10}, {-1, 0, 160, 56}, {0, 0, 0, 0}},  // 15
+        {{-1, 0, 17, 9}, {0, -1, 145, 48}, {0, 0, 0, 0}},  // 16
+        {{0, -1, 18, 11}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 17
+        {{0, -1, 19, 12}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 18
+        {{-1, 0, 20, 13}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 19
+        {{0, -1, 21, 14}, {-1, 0, 114, 13}, {0, 0, 0, 0}},  // 20
+        {{1, 0, 22, 11}, {0, -1, 102, 47}, {-1, 0, 88, 44}},  // 21
+        {{0, -1, 23, 15}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 22
+        {{1, 0, 24, 16}, {0, -1, 159, 17}, {1, -1, 23, 15}},  // 23
+        {{0, -1, 25, 17}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 24
+        {{1, 0, 26, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 25
+        {{1, 0, 27, 19}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 26
+        {{1, 0, 28, 19}, {0, -1, 42, 28}, {0, 1, 158, 17}},  // 27
+        {{1, 0, 29, 19}, {0, 1, 156, 20}, {0, -1, 157, 20}},  // 28
+        {{1, 0, 29, 19}, {0, 1, 30, 20}, {0, -1, 151, 20}},  // 29
+        {{1, 0, 31, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 30
+        {{1, 0, 32, 22}, {0, 1, 150, 33}, {1, 1, 49, 21}},  // 31
+        {{0, 1, 33, 23}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 32
+        {{1, 0, 34, 24}, {0, 1, 148, 25}, {0, 0, 0, 0}},  // 33
+        {{1, 0, 35, 19}, {0, 1, 49, 21}, {0, -1, 147, 26}},  // 34
+        {{0, 1, 36, 25}, {1, 0, 28, 19}, {0, -1, 53, 31}},  // 35
+        {{1, 0, 37, 24}, {0, 1, 148, 25}, {0, 0, 0, 0}},  // 36
+        {{1, 0, 38, 19}, {0, 1, 49, 21}, {0, -1, 147, 26}},  // 37
+        {{0, 1, 36, 25}, {1, 0, 28, 19}, {0, -1, 39, 26}},  // 38
+        {{1, 0, 40, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 39
+        {{1, 0, 41, 27}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 40
+        {{0, -1, 42, 28}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 41
+        {{1, 0, 43, 29}, {0, -1, 144, 28}, {0, 0, 0, 0}},  // 42
+        {{1, 0, 44, 19}, {0, 1, 48, 18}, {0, -1, 23, 15}},  // 43
+        {{1, 0, 28, 19}, {0, -1, 42, 28}, {0, 1, 45, 18}},  // 44
+        {{1, 0, 46, 26}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 45
+        {{1, 0, 47, 30}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 46
+        {{0, 1, 36, 25}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 47
+        {{1, 0, 49, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 48
+        {{1, 0, 50, 22}, {0, 1, 54, 31}, {1, 1, 49, 21}},  // 49
+        {{0, 1, 51, 31}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 50
+        {{1, 0, 52, 26}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 51
+        {{1, 0, 35, 19}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 52
+        {{1, 0, 40, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 53
+        {{1, 0, 55, 22}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 54
+        {{0, 1, 56, 32}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 55
+        {{0, 1, 57, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 56
+        {{1, 0, 58, 33}, {0, 1, 1, 1}, {-1, 0, 143, 22}},  // 57
+        {{0, 1, 59, 34}, {1, 0, 141, 33}, {0, 0, 0, 0}},  // 58
+        {{0, 1, 60, 1}, {1, 0, 49, 21}, {-1, 0, 140, 32}},  // 59
+        {{1, 0, 58, 33}, {-1, 0, 61, 32}, {0, 1, 1, 1}},  // 60
+        {{0, 1, 62, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 61
+        {{0, 1, 63, 36}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 62
+        {{-1, 0, 64, 37}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 63
+        {{0, 1, 65, 38}, {-1, 0, 78, 37}, {0, 0, 0, 0}},  // 64
+        {{-1, 0, 66, 2}, {0, 1, 75, 1}, {1, 0, 77, 35}},  // 65
+        {{-1, 0, 67, 39}, {0, 1, 68, 4}, {-1, 1, 66, 2}},  // 66
+        {{0, 1, 6, 4}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 67
+        {{-1, 0, 69, 39}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 68
+        {{0, 1, 70, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 69
+        {{0, 1, 71, 1}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 70
+        {{-1, 0, 64, 37}, {1, 0, 72, 39}, {0, 1, 1, 1}},  // 71
+        {{0, 1, 73, 32}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 72
+        {{0, 1, 74, 40}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 73
+        {{1, 0, 58, 33}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 74
+        {{-1, 0, 64, 37}, {0, 1, 1, 1}, {1, 0, 76, 35}},  // 75
+        {{0, 1, 73, 32}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 76
+        {{0, 1, 49, 21}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 77
+        {{0, 1, 79, 36}, {-1, 0, 82, 42}, {0, 0, 0, 0}},  // 78
+        {{-1, 0, 80, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 79
+        {{-1, 0, 81, 41}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 80
+        {{0, 1, 9, 3}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 81
+        {{-1, 0, 83, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 82
+        {{-1, 0, 84, 6}, {0, 1, 138, 42}, {0, -1, 139, 42}},  // 83
+        {{-1, 0, 84, 6}, {0, 1, 85, 42}, {0, -1, 131, 42}},  // 84
+        {{-1, 0, 86, 43}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 85
+        {{-1, 0, 81, 41}, {0, 1, 130, 37}, {-1, 1, 66, 2}},  // 86
+        {{-1, 0, 88, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 87
+        {{0, -1, 89, 45}, {-1, 0, 127, 46}, {-1, -1, 88, 44}},  // 88
+        {{-1, 0, 90, 46}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 89
+        {{0, -1, 91, 11}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 90
+        {{0, -1, 92, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 91
+        {{0, -1, 93, 47}, {-1, 0, 20, 13}, {1, 0, 126, 46}},  // 92
+        {{0, -1, 94, 47}, {-1, 0, 124, 48}, {1, 0, 125, 48}},  // 93
+        {{-1, 0, 95, 48}, {0, -1, 94, 47}, {1, 0, 116, 48}},  // 94
+        {{0, -1, 96, 49}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 95
+        {{-1, 0, 97, 10}, {0, -1, 19, 12}, {-1, -1, 88, 44}},  // 96
+        {{-1, 0, 14, 9}, {0, -1, 98, 45}, {0, 0, 0, 0}},  // 97
+        {{-1, 0, 99, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 98
+        {{-1, 0, 100, 6}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 99
+        {{0, -1, 15, 10}, {-1, 0, 83, 6}, {0, 1, 101, 45}},  // 100
+        {{-1, 0, 80, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 101
+        {{0, -1, 93, 47}, {-1, 0, 20, 13}, {1, 0, 103, 11}},  // 102
+        {{0, -1, 104, 50}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 103
+        {{0, -1, 105, 51}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 104
+        {{1, 0, 106, 52}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 105
+        {{0, -1, 107, 53}, {1, 0, 111, 52}, {0, 0, 0, 0}},  // 106
+        {{0, -1, 108, 47}, {1, 0, 23, 15}, {-1, 0, 110, 50}},  // 107
+        {{1, 0, 106, 52}, {0, -1, 93, 47}, {-1, 0, 109, 50}},  // 108
+        {{0, -1, 18, 11}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 109
+        {{0, -1, 88, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 110
+        {{0, -1, 112, 51}, {1, 0, 113, 20}, {0, 0, 0, 0}},  // 111
+        {{1, 0, 40, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 112
+        {{1, 0, 28, 19}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 113
+        {{-1, 0, 82, 42}, {0, -1, 115, 12}, {0, 0, 0, 0}},  // 114
+        {{-1, 0, 13, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 115
+        {{0, -1, 117, 15}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 116
+        {{1, 0, 118, 28}, {0, -1, 119, 17}, {1, -1, 23, 15}},  // 117
+        {{1, 0, 41, 27}, {0, -1, 25, 17}, {0, 0, 0, 0}},  // 118
+        {{1, 0, 120, 54}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 119
+        {{0, -1, 121, 53}, {1, 0, 111, 52}, {0, 0, 0, 0}},  // 120
+        {{1, 0, 23, 15}, {0, -1, 122, 47}, {-1, 0, 110, 50}},  // 121
+        {{1, 0, 106, 52}, {0, -1, 93, 47}, {-1, 0, 123, 16}},  // 122
+        {{0, -1, 18, 11}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 123
+        {{0, -1, 18, 11}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 124
+        {{0, -1, 104, 50}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 125
+        {{0, -1, 104, 50}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 126
+        {{0, -1, 98, 45}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 127
+        {{0, 1, 0, 0}, {-1, 0, 129, 41}, {0, 0, 0, 0}},  // 128
+        {{0, 1, 62, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 129
+        {{-1, 0, 69, 39}, {0, 1, 63, 36}, {0, 0, 0, 0}},  // 130
+        {{-1, 0, 132, 44}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 131
+        {{-1, 0, 133, 46}, {0, -1, 137, 13}, {-1, -1, 88, 44}},  // 132
+        {{0, -1, 134, 55}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 133
+        {{-1, 0, 135, 56}, {0, -1, 16, 10}, {0, 0, 0, 0}},  // 134
+        {{-1, 0, 100, 6}, {0, -1, 88, 44}, {0, 1, 136, 8}},  // 135
+        {{-1, 0, 66, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 136
+        {{-1, 0, 90, 46}, {0, -1, 19, 12}, {0, 0, 0, 0}},  // 137
+        {{-1, 0, 80, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 138
+        {{-1, 0, 13, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 139
+        {{0, 1, 66, 2}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 140
+        {{1, 0, 113, 20}, {0, 1, 142, 40}, {0, 0, 0, 0}},  // 141
+        {{1, 0, 46, 26}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 142
+        {{0, 1, 62, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 143
+        {{0, -1, 145, 48}, {1, 0, 146, 27}, {0, 0, 0, 0}},  // 144
+        {{0, -1, 93, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 145
+        {{0, -1, 104, 50}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 146
+        {{1, 0, 23, 15}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 147
+        {{0, 1, 0, 0}, {1, 0, 149, 30}, {0, 0, 0, 0}},  // 148
+        {{0, 1, 73, 32}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 149
+        {{0, 1, 74, 40}, {1, 0, 55, 22}, {0, 0, 0, 0}},  // 150
+        {{1, 0, 152, 57}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 151
+        {{1, 0, 41, 27}, {0, -1, 153, 52}, {1, -1, 23, 15}},  // 152
+        {{0, -1, 105, 51}, {1, 0, 154, 16}, {0, 0, 0, 0}},  // 153
+        {{0, -1, 155, 50}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 154
+        {{0, -1, 122, 47}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 155
+        {{1, 0, 46, 26}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 156
+        {{1, 0, 40, 18}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 157
+        {{1, 0, 46, 26}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 158
+        {{1, 0, 154, 16}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 159
+        {{-1, 0, 161, 6}, {0, -1, 88, 44}, {0, 1, 136, 8}},  // 160
+        {{0, -1, 15, 10}, {-1, 0, 83, 6}, {0, 1, 162, 8}},  // 161
+        {{-1, 0, 80, 5}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 162
+        {{-1, 0, 13, 8}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 163
+        {{-1, 0, 165, 58}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 164
+        {{0, 1, 166, 38}, {-1, 0, 78, 37}, {0, 0, 0, 0}},  // 165
+        {{-1, 0, 66, 2}, {0, 1, 71, 1}, {1, 0, 77, 35}},  // 166
+        {{0, 1, 168, 59}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 167
+        {{0, 1, 74, 40}, {1, 0, 169, 25}, {1, 1, 49, 21}},  // 168
+        {{1, 0, 47, 30}, {0, 1, 51, 31}, {0, 0, 0, 0}},  // 169
+        {{0, 1, 62, 35}, {0, 0, 0, 0}, {0, 0, 0, 0}},  // 170
+        {{0, 1, 73, 32}, {0, 0, 0, 0}, {0, 0, 0, 0}}  // 171
+    };
+};
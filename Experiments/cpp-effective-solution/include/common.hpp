@@ -2,19 +2,20 @@
 Данный код реализует эффективный вариант алгоритмов (поиск на state lattice и поиск на графе типов)
 для их тестирования на многих картах и сценариях.
 В этом файле перечислены различные настройки, на основании которых будет работать код.
-Если хочется запустить тестирования с разными настройками (например, если есть два control set - один для
-16 дискретных углов, другой для 8), то можно просто запустить несколько копий данной программы, и в каждой из
-них описать все настройки в данном файле нужным образом.
+Количество дискретных направлений, количество типов и размеры карты здесь не задаются: они берутся из загруженных
+файлов (control set, типов и карты), поэтому одна и та же программа работает, например, и с control set для
+16 дискретных углов, и с control set для 8 углов.
 */
 
 #pragma once
 
-#define ANGLE_NUM 16  // количество дискретных направлений
-#define MAX_TYPES 1500  // максимальное количество типов, которое будет использоваться на графе типов
+#define MAX_ANGLE_NUM 32  // максимальное количество дискретных направлений (маски углов хранятся в uint32_t)
 #define MAX_TESTS 10000  // максимальное количество тестов (пары дискретных состояний, между которыми искать путь) для каждой карты
-#define MAX_MAP_WIDTH 1200  // максимальные размеры карты, на которой будет производиться тестирование.
-#define MAX_MAP_HEIGHT 1200
-#define MAX_INFO 500  // максимальное количество различных информаций для склеивания вершин на графе типов
+#define HIERARCHY_CLUSTER_SIZE 32  // размер кластера иерархической абстракции карты по умолчанию (см. KC_hierarchy.hpp)
+#define MAX_KEPT_NODES 4000000  // сколько вершин поиска могут занимать деревья, сохранённые потоком сервера между запросами (см. KC_reuse.hpp)
 
-
-// !!! MAX_INFO должен быть >= ANGLE_NUM (для использования fast (списка битов в качестве CLOSED) в дереве поиска)
+//#define TRAJECTORY_FLOAT32  // объявляем, если точки траекторий примитивов нужно хранить в float, а не в половинной точности (см. ControlSet)
+//#define SIMD_HEURISTIC  // объявляем, если эвристику последователей нужно считать векторными ядрами в double, а не в long double (см. KC_simd.hpp)
+//#define SIMD_CHECK  // объявляем, если каждый пакет эвристик из векторного ядра нужно сверять со скалярным (см. KC_simd.hpp)
+//#define SEARCH_STATS  // объявляем, если хотим собирать подробную статистику поиска (см. KC_stats.hpp)
+//#define PERF_COUNTERS  // объявляем, если хотим читать аппаратные счётчики процессора во время тестирования (см. KC_perf.hpp)
@@ -0,0 +1,534 @@
+/*
+Данный файл содержит набор микро-бенчмарков для "горячих" частей кода: рукописной кучи MyHEAP, списков OPEN и
+CLOSED в SearchTree, проверки примитивов на коллизии, генерации последователей,
+вычисления эвристик и поиска (по одному и пакетами). Для main_types, big_types и short_types дополнительно
+замеряются генерация последователей и поиск со сгенерированной таблицей типов (StaticTypesGraphParams).
+В качестве входных данных используются настоящие карты из maps/ и control set (и типы) из data/.
+
+Сборка и запуск: make bench (результат в формате JSON сохраняется в файл bench.json, так что его можно
+сравнивать между версиями кода и отслеживать ухудшения). Можно запустить и вручную:
+    ./bench_astar [карта] [control_set] [файл для результата]
+например, ./bench_astar Milan_1_256 main_control_set bench.json (тогда типы берутся из файла data/main_types.txt).
+*/
+
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+#include "KC_heap.hpp"
+#include "KC_searching.hpp"
+#include "KC_structs.hpp"
+#include "KC_replanning.hpp"
+#include "KC_batch.hpp"
+#include "KC_simd.hpp"
+#include "KC_static_types.hpp"
+#include "KC_types_main.hpp"
+#include "KC_types_big.hpp"
+#include "KC_types_short.hpp"
+#include "common.hpp"
+#include "rassert.hpp"
+
+using namespace std;
+
+thread_local MyHEAP *HEAP;
+
+#define BENCH_REPEATS 5  // сколько раз повторять каждый замер (в результат идёт медиана)
+
+static volatile long long sink = 0;  // сюда складываем результаты вычислений, чтобы компилятор их не выкинул
+
+
+
+
+struct BenchResult {
+    /*
+    Результат одного бенчмарка: имя, количество операций в одном замере и время на одну операцию (медиана по замерам).
+    */
+
+    string name;
+    long long ops;
+    double ns_per_op;
+};
+
+
+template <typename F>
+static BenchResult run_bench(string name, long long ops, F body) {
+    /*
+    Данная функция BENCH_REPEATS раз запускает функцию body (которая делает ops операций) и возвращает
+    медианное время на одну операцию.
+    */
+
+    vector <double> times;
+    for (int r = 0; r < BENCH_REPEATS; r ++) {
+        auto t0 = chrono::steady_clock::now();
+        body();
+        auto t1 = chrono::steady_clock::now();
+        times.push_back(chrono::duration <double, nano> (t1 - t0).count() / ops);
+    }
+    sort(times.begin(), times.end());
+
+    cout << name << ": " << times[BENCH_REPEATS / 2] << " ns/op" << endl;
+    return {name, ops, times[BENCH_REPEATS / 2]};
+}
+
+
+static void random_free_states(Map *map, int theta_amount, int n, vector <Vertex> &states, mt19937 &rng) {
+    /*
+    Данная функция генерирует n случайных дискретных состояний (из theta_amount направлений) в свободных клетках карты map.
+    */
+
+    uniform_int_distribution <int> di(0, map->height - 1), dj(0, map->width - 1), dt(0, theta_amount - 1);
+    while ((int) states.size() < n) {
+        int i = di(rng), j = dj(rng);
+        if (map->traversable(i, j))
+            states.push_back(Vertex(i, j, dt(rng)));
+    }
+}
+
+
+
+
+static BenchResult bench_heap() {
+    /*
+    Выделение и освобождение SearchNode (вместе с Vertex) в рукописной куче: сначала выделяем пачку, затем всю её удаляем.
+    */
+
+    const int batch = 1000, rounds = 1000;
+    vector <ptrSearchNode> nodes(batch);
+    return run_bench("heap_new_delete", 1ll * batch * rounds, [&]() {
+        for (int r = 0; r < rounds; r ++) {
+            for (int k = 0; k < batch; k ++)
+                nodes[k] = HEAP->new_SearchNode(HEAP->new_Vertex(k, r, 0));
+            for (int k = batch - 1; k >= 0; k --)
+                HEAP->delete_SearchNode(nodes[k]);
+        }
+    });
+}
+
+
+static BenchResult bench_open(mt19937 &rng) {
+    /*
+    Добавление вершин поиска со случайными f-значениями в OPEN и их извлечение в порядке возрастания f.
+    */
+
+    const int n = 200000;
+    vector <long double> fs(n);
+    uniform_real_distribution <double> df(0, 1000);
+    for (int k = 0; k < n; k ++)
+        fs[k] = df(rng);
+
+    SearchTree *ast = new SearchTree(false, 0, 0, 0);  // CLOSED тут не нужен, поэтому не заводим fast_closed
+    BenchResult res = run_bench("searchtree_push_pop", 2ll * n, [&]() {
+        for (int k = 0; k < n; k ++) {
+            ptrSearchNode node = HEAP->new_SearchNode(HEAP->new_Vertex(k % 1000, k / 1000, 0));
+            node->f = node->g = fs[k];
+            ast->add_to_open(node);
+        }
+        while (!ast->open_is_empty()) {
+            ptrSearchNode node = ast->get_best_node_from_open();
+            sink += node.ind;
+            HEAP->delete_SearchNode(node);
+        }
+    });
+    delete ast;
+    return res;
+}
+
+
+static BenchResult bench_closed(Map *map, int theta_amount, bool fast, mt19937 &rng) {
+    /*
+    Проверка was_expanded для CLOSED в виде набора битов (fast = 1) или хеш-множества (fast = 0).
+    Половина запрашиваемых вершин лежит в CLOSED, половина - нет.
+    */
+
+    const int n = 100000, queries = 1000000;
+    vector <Vertex> states;
+    random_free_states(map, theta_amount, 2 * n, states, rng);
+
+    SearchTree *ast = new SearchTree(fast, map->height, map->width, theta_amount);
+    for (int k = 0; k < n; k ++) {
+        ptrSearchNode node = HEAP->new_SearchNode(HEAP->new_Vertex(states[k].i, states[k].j, states[k].theta));
+        ast->add_to_closed(node);
+    }
+    vector <ptrVertex> query;
+    for (int k = 0; k < 2 * n; k ++)
+        query.push_back(HEAP->new_Vertex(states[k].i, states[k].j, states[k].theta));
+    shuffle(query.begin(), query.end(), rng);
+
+    BenchResult res = run_bench(fast ? "was_expanded_fast" : "was_expanded_set", queries, [&]() {
+        long long cnt = 0;
+        for (int k = 0; k < queries; k ++)
+            cnt += ast->was_expanded(query[k % (2 * n)]);
+        sink += cnt;
+    });
+
+    for (ptrVertex v: query)
+        HEAP->delete_Vertex(v);
+    delete ast;
+    return res;
+}
+
+
+static BenchResult bench_check_prim(Map *map, ControlSet *control_set, mt19937 &rng) {
+    /*
+    Проверка на коллизии всех примитивов, выходящих из случайных состояний карты.
+    */
+
+    const int n = 20000;
+    vector <Vertex> states;
+    random_free_states(map, control_set->theta_amount, n, states, rng);
+    long long ops = 0;
+    for (Vertex &s: states)
+        ops += control_set->get_prims_by_heading(s.theta).size();
+
+    StateLatticeParams *p = new StateLatticeParams(&states[0], &states[1], map, control_set, false, "COST");
+    BenchResult res = run_bench("check_prim", ops, [&]() {
+        long long cnt = 0;
+        for (Vertex &s: states)
+            for (Primitive *prim: control_set->get_prims_by_heading(s.theta))
+                cnt += p->check_prim(s.i, s.j, prim);
+        sink += cnt;
+    });
+    delete p->ast;
+    delete p;
+    return res;
+}
+
+
+template <typename T>
+static BenchResult bench_successors(string name, T *p, vector <ptrVertex> &vertexs) {
+    /*
+    Генерация последователей (get_successors) для набора вершин vertexs (в один буфер, без выделений памяти).
+    */
+
+    Successors list;
+    list.reserve(p->max_degree);
+    return run_bench(name, vertexs.size(), [&]() {
+        for (ptrVertex v: vertexs) {
+            list.clear();
+            p->get_successors(v, list);
+            sink += list.size;
+        }
+    });
+}
+
+
+template <typename T>
+static BenchResult bench_heuristic(string name, T *p, vector <ptrVertex> &vertexs) {
+    /*
+    Вычисление эвристики для набора вершин vertexs.
+    */
+
+    const int rounds = 20;
+    return run_bench(name, 1ll * rounds * vertexs.size(), [&]() {
+        long double sum = 0;
+        for (int r = 0; r < rounds; r ++)
+            for (ptrVertex v: vertexs)
+                sum += p->heuristic(v);
+        sink += (long long) sum;
+    });
+}
+
+
+template <typename T>
+static BenchResult bench_is_goal(string name, T *p, vector <ptrVertex> &vertexs) {
+    /*
+    Проверка цели (is_goal по goal_region) для набора вершин vertexs.
+    */
+
+    const int rounds = 20;
+    return run_bench(name, 1ll * rounds * vertexs.size(), [&]() {
+        long long goals = 0;
+        for (int r = 0; r < rounds; r ++)
+            for (ptrVertex v: vertexs)
+                goals += p->is_goal(v);
+        sink += goals;
+    });
+}
+
+
+template <typename T>
+static BenchResult bench_heuristic_batch(string name, T *p, vector <ptrVertex> &vertexs) {
+    /*
+    Вычисление эвристики для того же набора вершин пакетами по 32 (как для последователей при раскрытии).
+    */
+
+    const int rounds = 20, size = 32;
+    vector <int> i, j;
+    for (ptrVertex v: vertexs) {
+        i.push_back(v->i);
+        j.push_back(v->j);
+    }
+    vector <long double> h(size);
+    return run_bench(name, 1ll * rounds * (vertexs.size() / size) * size, [&]() {
+        long double sum = 0;
+        for (int r = 0; r < rounds; r ++)
+            for (size_t k = 0; k + size <= vertexs.size(); k += size) {
+                p->heuristic_batch(&i[k], &j[k], size, h.data());
+                sum += h[k % size];
+            }
+        sink += (long long) sum;
+    });
+}
+
+
+static BenchResult bench_kernel(string name, bool simd, bool octile, vector <ptrVertex> &vertexs, Vertex *goal) {
+    /*
+    Векторное (simd = 1) или скалярное ядро эвристики из KC_simd.hpp на том же наборе вершин (пакетами по 32).
+    Заодно проверяем, что векторное ядро побитово совпадает со скалярным.
+    */
+
+    const int rounds = 20, size = 32;
+    vector <int> i, j;
+    for (ptrVertex v: vertexs) {
+        i.push_back(v->i);
+        j.push_back(v->j);
+    }
+    auto kernel = simd ? (octile ? octile_batch : euclid_batch) : (octile ? octile_batch_scalar : euclid_batch_scalar);
+    auto scalar = octile ? octile_batch_scalar : euclid_batch_scalar;
+
+    int n = (i.size() / size) * size;
+    vector <double> h(n), expected(n);
+    kernel(i.data(), j.data(), n, goal->i, goal->j, h.data());
+    scalar(i.data(), j.data(), n, goal->i, goal->j, expected.data());
+    if (memcmp(h.data(), expected.data(), n * sizeof(double)) != 0)
+        throw runtime_error("Векторное ядро эвристики разошлось со скалярным!");
+
+    return run_bench(name, 1ll * rounds * n, [&]() {
+        double sum = 0;
+        for (int r = 0; r < rounds; r ++)
+            for (int k = 0; k < n; k += size) {
+                kernel(&i[k], &j[k], size, goal->i, goal->j, &h[k]);
+                sum += h[k];
+            }
+        sink += (long long) sum;
+    });
+}
+
+
+template <typename T>
+static BenchResult bench_replan(string name, T *p, Map *map) {
+    /*
+    Исправление пути инкрементальным поиском (KC_replanning.hpp): в середине найденного пути занимаем квадрат 3x3
+    клеток и исправляем путь, затем освобождаем квадрат и исправляем путь снова (одна операция - одно исправление).
+    Карта после замера остаётся прежней.
+    */
+
+    IncrementalSearch <T> replan(p);
+    ResultReplan res = replan.search();
+    rassert(res.find_path == 1, "Для бенчмарка исправления пути старт и цель должны быть достижимы!");
+    Vertex middle = res.path[res.path.size() / 2];
+
+    vector <CellUpdate> block, unblock;
+    for (int di = -1; di <= 1; di ++)
+        for (int dj = -1; dj <= 1; dj ++)
+            if (map->in_bounds(middle.i + di, middle.j + dj) && map->traversable(middle.i + di, middle.j + dj)) {
+                block.push_back({middle.i + di, middle.j + dj, true});
+                unblock.push_back({middle.i + di, middle.j + dj, false});
+            }
+
+    return run_bench(name, 2, [&]() {
+        replan.cells_changed(map->set_cells(block));
+        sink += replan.search().steps;
+        replan.cells_changed(map->set_cells(unblock));
+        sink += replan.search().steps;
+    });
+}
+
+
+
+
+template <typename T>
+static BenchResult bench_batch(string name, int K, Map *map, TypeInfo *type_info, vector <pair <Vertex, Vertex>> &tasks,
+                               bool goal_at_generation = false, bool fast_closed = false, bool interleave = true) {
+    /*
+    Поиск на графе типов для всех задач tasks (одна операция - один поиск): по одному (K = 1, AstarSearch) или
+    пакетами по K запросов, которые выполняются вперемешку (AstarBatch, см. KC_batch.hpp). С goal_at_generation
+    цель проверяется уже при генерации последователей. С fast_closed у каждого запроса битовый CLOSED на всю карту
+    (height * width * info_amount бит) - только его AstarBatch и подгружает заранее (prefetch_closed), поэтому
+    выигрыш от предвыборки стоит смотреть по вариантам с fast_closed на карте, где битовые CLOSED всего пакета не
+    помещаются в кэш последнего уровня. Если interleave = 0, то запросы пакета создаются вместе (память та же), но
+    ищутся по одному AstarSearch - так разница с AstarBatch - это только чередование и предвыборка.
+    */
+
+    return run_bench(name, tasks.size(), [&]() {
+        for (size_t b = 0; b < tasks.size(); b += K) {
+            vector <T*> queries;
+            for (size_t k = b; k < min(tasks.size(), b + K); k ++) {
+                queries.push_back(new T(&tasks[k].first, &tasks[k].second, map, type_info, fast_closed));
+                queries.back()->goal_at_generation = goal_at_generation;
+            }
+            vector <ResultSearch> res;
+            if (K == 1 || !interleave)
+                for (T *q: queries)
+                    res.push_back(AstarSearch(q));
+            else
+                res = AstarBatch(queries);
+            for (size_t k = 0; k < queries.size(); k ++) {
+                sink += res[k].steps;
+                if (res[k].find_path)
+                    HEAP->delete_SearchNode(res[k].final_node);
+                delete queries[k]->ast;
+                delete queries[k];
+            }
+        }
+    });
+}
+
+
+
+
+template <typename F>
+static bool with_types_table(string types_name, F f) {
+    /*
+    Данная функция вызывает f(Table *) со сгенерированной таблицей типов types_name (указатель нулевой - нужен только
+    его тип) и возвращает 0, если для этих типов таблица не сгенерирована.
+    */
+
+    if (types_name == "main_types")
+        f((MainTypes *) NULL);
+    else if (types_name == "big_types")
+        f((BigTypes *) NULL);
+    else if (types_name == "short_types")
+        f((ShortTypes *) NULL);
+    else
+        return 0;
+    return 1;
+}
+
+
+
+
+int main(int argc, char **argv) {
+    string map_name = (argc > 1) ? argv[1] : "Milan_1_256";
+    string cs_name = (argc > 2) ? argv[2] : "main_control_set";
+    string out_name = (argc > 3) ? argv[3] : "bench.json";
+    string types_name = cs_name.substr(0, cs_name.find("_control_set")) + "_types";
+
+    HEAP = new MyHEAP();
+    mt19937 rng(12345);  // фиксированный seed, чтобы входные данные между запусками совпадали
+
+    Map *map = new Map();
+    map->read_file_to_cells("maps/" + map_name + ".map");
+    ControlSet *control_set = new ControlSet();
+    control_set->load_primitives("data/" + cs_name + ".txt");
+    TypeInfo *type_info = new TypeInfo();
+    type_info->load_types("data/" + types_name + ".txt");
+
+    vector <BenchResult> results;
+    results.push_back(bench_heap());
+    results.push_back(bench_open(rng));
+    results.push_back(bench_closed(map, control_set->theta_amount, true, rng));
+    results.push_back(bench_closed(map, control_set->theta_amount, false, rng));
+    results.push_back(bench_check_prim(map, control_set, rng));
+
+    // вершины, для которых генерируем последователей и считаем эвристику: состояния state lattice и типовые ячейки
+    const int n = 20000;
+    vector <Vertex> states;
+    random_free_states(map, control_set->theta_amount, n + 1, states, rng);
+    vector <ptrVertex> lattice_vertexs, types_vertexs;
+    for (int k = 0; k < n; k ++) {
+        lattice_vertexs.push_back(HEAP->new_Vertex(states[k].i, states[k].j, states[k].theta));
+        int type = type_info->start_type_by_theta[states[k].theta];
+        types_vertexs.push_back(HEAP->new_Vertex(states[k].i, states[k].j, type, type_info->add_info_by_type[type]));
+    }
+
+    StateLatticeParams *prims = new StateLatticeParams(&states[0], &states[n], map, control_set, false, "PRIM");
+    StateLatticeParams *cost = new StateLatticeParams(&states[0], &states[n], map, control_set, false, "COST");
+    TypesGraphParams *types = new TypesGraphParams(&states[0], &states[n], map, type_info, false);
+
+    results.push_back(bench_successors("get_successors_lattice", cost, lattice_vertexs));
+    results.push_back(bench_successors("get_successors_types", types, types_vertexs));
+    with_types_table(types_name, [&](auto *table) {
+        using Table = remove_pointer_t <decltype(table)>;
+        StaticTypesGraphParams <Table> *types_static = new StaticTypesGraphParams <Table> (&states[0], &states[n], map, type_info, false);
+        results.push_back(bench_successors("get_successors_types_static", types_static, types_vertexs));
+        delete types_static->ast;
+        delete types_static;
+    });
+    results.push_back(bench_heuristic("heuristic_prim", prims, lattice_vertexs));
+    results.push_back(bench_heuristic("heuristic_cost", cost, lattice_vertexs));
+    results.push_back(bench_heuristic("heuristic_types", types, types_vertexs));
+    results.push_back(bench_is_goal("is_goal_lattice", cost, lattice_vertexs));
+    results.push_back(bench_is_goal("is_goal_types", types, types_vertexs));
+    results.push_back(bench_heuristic_batch("heuristic_batch_cost", cost, lattice_vertexs));
+    results.push_back(bench_heuristic_batch("heuristic_batch_types", types, types_vertexs));
+    results.push_back(bench_kernel("kernel_euclid_scalar", false, false, lattice_vertexs, &states[n]));
+    results.push_back(bench_kernel("kernel_euclid_simd", true, false, lattice_vertexs, &states[n]));
+    results.push_back(bench_kernel("kernel_octile_scalar", false, true, lattice_vertexs, &states[n]));
+    results.push_back(bench_kernel("kernel_octile_simd", true, true, lattice_vertexs, &states[n]));
+
+    // поиски по одному и пакетами: пары случайных состояний одной компоненты связности на расстоянии 20-60 клеток
+    vector <pair <Vertex, Vertex>> tasks;
+    for (int k = 0; k + 1 < n && tasks.size() < 16; k += 2) {
+        int dist = abs(states[k].i - states[k+1].i) + abs(states[k].j - states[k+1].j);
+        if (dist >= 20 && dist <= 60 && map->get_component(states[k].i, states[k].j) == map->get_component(states[k+1].i, states[k+1].j))
+            tasks.push_back({states[k], states[k+1]});
+    }
+    results.push_back(bench_batch <TypesGraphParams> ("search_types_sequential", 1, map, type_info, tasks));
+    results.push_back(bench_batch <TypesGraphParams> ("search_types_batch8", 8, map, type_info, tasks));
+    results.push_back(bench_batch <TypesGraphParams> ("search_types_goal_at_generation", 1, map, type_info, tasks, true));
+    results.push_back(bench_batch <TypesGraphParams> ("search_types_sequential_fast_closed", 1, map, type_info, tasks, false, true));
+    results.push_back(bench_batch <TypesGraphParams> ("search_types_sequential8_fast_closed", 8, map, type_info, tasks, false, true, false));
+    results.push_back(bench_batch <TypesGraphParams> ("search_types_batch8_fast_closed", 8, map, type_info, tasks, false, true));
+    results.push_back(bench_batch <TypesGraphParams> ("search_types_batch16_fast_closed", 16, map, type_info, tasks, false, true));
+    with_types_table(types_name, [&](auto *table) {
+        using Table = remove_pointer_t <decltype(table)>;
+        results.push_back(bench_batch <StaticTypesGraphParams <Table>> ("search_types_static", 1, map, type_info, tasks));
+    });
+
+    // исправление пути после изменения карты (в самом конце, так как меняет карту, хоть и возвращает её обратно);
+    // старт и цель - первая пара случайных состояний, между которыми есть путь не короче 20 клеток
+    StateLatticeParams *replan_params = NULL;
+    for (int k = 0; k + 1 < n && replan_params == NULL; k += 2) {
+        if (abs(states[k].i - states[k+1].i) + abs(states[k].j - states[k+1].j) < 20 ||
+            map->get_component(states[k].i, states[k].j) != map->get_component(states[k+1].i, states[k+1].j))
+            continue;
+        StateLatticeParams *p = new StateLatticeParams(&states[k], &states[k+1], map, control_set, false, "COST");
+        IncrementalSearch <StateLatticeParams> probe(p);
+        if (probe.search(1).find_path == 1)
+            replan_params = p;
+        else {
+            delete p->ast;
+            delete p;
+        }
+    }
+    rassert(replan_params != NULL, "Не нашлось пары состояний для бенчмарка исправления пути!");
+    results.push_back(bench_replan("replan_repair_lattice", replan_params, map));
+
+    // выводим результат в формате JSON
+    ofstream out(out_name);
+    rassert(out.is_open() == 1, "Не удалось открыть файл для результатов бенчмарков!");
+    out << "{\n  \"map\": \"" << map_name << "\",\n  \"control_set\": \"" << cs_name << "\",\n  \"benchmarks\": [\n";
+    for (size_t k = 0; k < results.size(); k ++) {
+        out << "    {\"name\": \"" << results[k].name << "\", \"ops\": " << results[k].ops
+            << ", \"ns_per_op\": " << results[k].ns_per_op << "}" << (k + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}" << endl;
+    out.close();
+
+    // очищаем память
+    for (int k = 0; k < n; k ++) {
+        HEAP->delete_Vertex(lattice_vertexs[k]);
+        HEAP->delete_Vertex(types_vertexs[k]);
+    }
+    for (StateLatticeParams *p: {prims, cost}) {
+        delete p->ast;
+        delete p;
+    }
+    delete types->ast;
+    delete types;
+    delete replan_params->ast;
+    delete replan_params;
+    delete map;
+    delete control_set;
+    delete type_info;
+    delete HEAP;
+    return 0;
+}
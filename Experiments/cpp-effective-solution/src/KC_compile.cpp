@@ -0,0 +1,190 @@
+/*
+Данный файл содержит программу compile_data, которая переводит текстовые файлы из data/ (сгенерированные кодом на
+Питоне) в скомпилированный бинарный формат. Бинарный файл не нужно разбирать построчно: он целиком отображается в
+память (см. KC_mmap.hpp), поэтому загружается практически мгновенно и в каждом процессе тестирования не копируется.
+
+Кроме того, по файлу с типами можно сгенерировать заголовочный файл с таблицей переходов в виде constexpr-массивов
+(для StaticTypesGraphParams, см. KC_static_types.hpp).
+
+Запуск:
+    ./compile_data prims data/main_control_set.txt data/main_control_set.bin
+    ./compile_data types data/main_types.txt data/main_types.bin
+    ./compile_data header data/main_types.txt include/KC_types_main.hpp
+Обычно запускать вручную не нужно: make compiled_data сам скомпилирует все файлы из data/, которые изменились, а
+make generated_types перегенерирует таблицы типов.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include "KC_heap.hpp"
+#include "KC_structs.hpp"
+#include "common.hpp"
+
+using namespace std;
+
+thread_local MyHEAP *HEAP;
+
+
+
+
+static string table_name(string file) {
+    /*
+    Имя структуры с таблицей по имени файла с типами: data/main_types.txt -> MainTypes.
+    */
+
+    string base = file.substr(file.find_last_of('/') + 1);
+    base = base.substr(0, base.find('.'));
+    string name;
+    bool upper = 1;
+    for (char c: base) {
+        if (c == '_') {
+            upper = 1;
+            continue;
+        }
+        name += upper ? toupper(c) : c;
+        upper = 0;
+    }
+    return name;
+}
+
+
+template <typename T>
+static void write_array(ofstream &out, string type, string name, const T *array, int n) {
+    out << "    static constexpr " << type << " " << name << "[" << n << "] = {";
+    for (int k = 0; k < n; k ++)
+        out << (k % 16 == 0 ? "\n        " : " ") << array[k] << (k + 1 < n ? "," : "");
+    out << "\n    };\n";
+}
+
+
+static void write_types_header(TypeInfo *type_info, string in, string file) {
+    /*
+    Данная функция записывает в file заголовочный файл с таблицей типов type_info (загруженных из in): все массивы,
+    которые поиск берёт из TypeInfo, в виде constexpr-массивов. Соседи каждого типа дополняются нулями до
+    max_degree (наибольшего количества соседей), так что цикл по соседям имеет постоянную границу и разворачивается
+    компилятором, а стоимость перехода не хранится - она определяется сдвигом (1 по стороне, diagonal_cost по углу).
+    */
+
+    ofstream out(file);
+    if (!out.is_open())
+        throw runtime_error("Не удалось создать файл: " + file);
+
+    string name = table_name(in);
+    int max_degree = 0;
+    long double diagonal_cost = 0;
+    for (int type = 0; type < type_info->types_amount; type ++)
+        max_degree = max(max_degree, type_info->succ_begin[type + 1] - type_info->succ_begin[type]);
+    for (long long k = 0; k < type_info->succ_amount; k ++) {
+        const TypeSuccessor &s = type_info->succ[k];
+        if (s.di != 0 && s.dj != 0)
+            diagonal_cost = s.cost;
+    }
+    for (long long k = 0; k < type_info->succ_amount; k ++) {  // стоимости должны однозначно определяться сдвигом
+        const TypeSuccessor &s = type_info->succ[k];
+        if (s.cost != ((s.di == 0 || s.dj == 0) ? 1 : diagonal_cost))
+            throw runtime_error("Стоимость перехода в файле с типами не определяется сдвигом: " + in);
+    }
+
+    out << "/*\n"
+        << "Данный файл сгенерирован программой compile_data по " << in << " (make generated_types) - не редактировать вручную.\n"
+        << "Таблица переходов графа типов для StaticTypesGraphParams (см. KC_static_types.hpp).\n"
+        << "*/\n\n"
+        << "#pragma once\n\n"
+        << "#include <cstdint>\n\n\n\n\n"
+        << "struct " << name << " {\n"
+        << "    struct Step {\n"
+        << "        int di, dj;\n"
+        << "        int type;\n"
+        << "        int info;\n"
+        << "    };\n\n"
+        << setprecision(numeric_limits <long double>::max_digits10)
+        << "    static constexpr const char *file = \"" << in << "\";\n"
+        << "    static constexpr uint64_t checksum = " << type_info->checksum() << "ull;  // TypeInfo::checksum\n"
+        << "    static constexpr int theta_amount = " << type_info->theta_amount << ";\n"
+        << "    static constexpr int types_amount = " << type_info->types_amount << ";\n"
+        << "    static constexpr int max_degree = " << max_degree << ";\n"
+        << "    static constexpr long double diagonal_cost = " << diagonal_cost << "L;\n\n";
+    write_array(out, "int", "start_type_by_theta", type_info->start_type_by_theta, type_info->theta_amount);
+    write_array(out, "uint32_t", "goal_mask_by_type", type_info->goal_mask_by_type, type_info->types_amount);
+    write_array(out, "int", "goal_theta_by_type", type_info->goal_theta_by_type, type_info->types_amount);
+    write_array(out, "int", "add_info_by_type", type_info->add_info_by_type, type_info->types_amount);
+
+    vector <int> degree(type_info->types_amount);
+    for (int type = 0; type < type_info->types_amount; type ++)
+        degree[type] = type_info->succ_begin[type + 1] - type_info->succ_begin[type];
+    write_array(out, "int", "degree_by_type", degree.data(), type_info->types_amount);
+
+    out << "    static constexpr Step succ[" << type_info->types_amount << "][" << max_degree << "] = {\n";
+    for (int type = 0; type < type_info->types_amount; type ++) {
+        out << "        {";
+        for (int k = 0; k < max_degree; k ++) {
+            int m = type_info->succ_begin[type] + k;
+            if (k < degree[type])
+                out << "{" << type_info->succ[m].di << ", " << type_info->succ[m].dj << ", " << type_info->succ[m].type
+                    << ", " << type_info->succ[m].info << "}";
+            else
+                out << "{0, 0, 0, 0}";
+            out << (k + 1 < max_degree ? ", " : "");
+        }
+        out << "}" << (type + 1 < type_info->types_amount ? "," : "") << "  // " << type << "\n";
+    }
+    out << "    };\n"
+        << "};\n";
+}
+
+
+
+
+int main(int argc, char **argv) {
+    if (argc != 4) {
+        cout << "Использование: " << argv[0] << " prims|types|header <текстовый файл> <бинарный или заголовочный файл>" << endl;
+        return 1;
+    }
+
+    string kind = argv[1];
+    string in = argv[2];
+    string out = argv[3];
+
+    try {
+        if (kind == "prims") {
+            ControlSet *control_set = new ControlSet();
+            control_set->load_primitives(in);
+            control_set->save_binary(out);
+            long long all_cells = 0;  // сколько клеток было бы в следах без учёта симметрии
+            for (int theta = 0; theta < control_set->theta_amount; theta ++)
+                for (Primitive *prim: control_set->get_prims_by_heading(theta))
+                    all_cells += prim->collision_size;
+            cout << "Скомпилировано примитивов: " << control_set->prims_amount << ", клеток в следах: " << control_set->cells_amount
+                 << " (без учёта симметрии было бы " << all_cells << ")" << endl;
+            delete control_set;
+        } else if (kind == "types") {
+            TypeInfo *type_info = new TypeInfo();
+            type_info->load_types(in);
+            type_info->save_binary(out);
+            cout << "Скомпилировано типов: " << type_info->types_amount << " (в файле " << type_info->file_types_amount
+                 << "), переходов: " << type_info->succ_amount << endl;
+            delete type_info;
+        } else if (kind == "header") {
+            TypeInfo *type_info = new TypeInfo();
+            type_info->load_types(in);
+            write_types_header(type_info, in, out);
+            cout << "Сгенерирована таблица " << table_name(in) << ": типов " << type_info->types_amount
+                 << ", переходов " << type_info->succ_amount << endl;
+            delete type_info;
+        } else {
+            cout << "Неизвестный вид файла: " << kind << endl;
+            return 1;
+        }
+    } catch (exception &e) {
+        cout << "Ошибка: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
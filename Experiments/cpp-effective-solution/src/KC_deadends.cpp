@@ -0,0 +1,208 @@
+#include <cstring>
+#include <stdexcept>
+
+#include "KC_deadends.hpp"
+#include "KC_search_params.hpp"
+#include "common.hpp"
+#include "rassert.hpp"
+
+
+
+
+DeadEnds::DeadEnds() {
+    /*
+    Конструктор. Пока маска не посчитана, тупиков нет.
+    */
+
+    height = width = theta_amount = 0;
+    dead_amount = 0;
+    bits = NULL;
+}
+
+
+void DeadEnds::load_or_compute(Map *map, ControlSet *control_set, string map_file, string cache_file) {
+    /*
+    Данная функция загружает маску тупиков карты map (прочитанной из map_file) для control_set из кэша cache_file,
+    а если кэша нет или он устарел - считает её и сохраняет в cache_file (если сохранить не удалось, просто работаем без кэша).
+    */
+
+    theta_amount = control_set->theta_amount;
+
+    uint64_t control_set_checksum = control_set->checksum();
+    if (load_cache(map_file, cache_file, control_set_checksum))
+        return;
+
+    compute(map, control_set);
+    try {
+        save_cache(map_file, cache_file, control_set_checksum);
+    } catch (exception &e) {
+        (void) e;
+    }
+}
+
+
+void DeadEnds::compute(Map *map, ControlSet *control_set) {
+    /*
+    Данная функция находит все тупиковые состояния карты map для control_set (см. описание в KC_deadends.hpp).
+    */
+
+    height = map->height;
+    width = map->width;
+    size_t states = (size_t) height * width * theta_amount;
+
+    Vertex dummy(0, 0, 0);
+    StateLatticeParams params(&dummy, &dummy, map, control_set, false, "COST");  // нужен только ради check_prim
+
+    // для каждого состояния считаем, сколько из него выходит допустимых примитивов в (пока) не тупиковые состояния:
+    vector <uint8_t> alive_out(states, 0);
+    vector <uint8_t> dead(states, 0);
+    vector <size_t> queue;  // тупики, предшественников которых ещё нужно обработать
+    for (int i = 0; i < height; i ++)
+        for (int j = 0; j < width; j ++) {
+            if (!map->traversable(i, j))
+                continue;
+            for (int theta = 0; theta < theta_amount; theta ++) {
+                int cnt = 0;
+                for (Primitive *prim: control_set->get_prims_by_heading(theta))
+                    cnt += params.check_prim(i, j, prim);
+                alive_out[state(i, j, theta)] = cnt;
+                if (cnt == 0) {
+                    dead[state(i, j, theta)] = 1;
+                    queue.push_back(state(i, j, theta));
+                }
+            }
+        }
+
+    // обратный проход: у каждого нового тупика уменьшаем счётчик его предшественникам
+    for (size_t q = 0; q < queue.size(); q ++) {
+        size_t u = queue[q];
+        int theta = u % theta_amount;
+        int i = (u / theta_amount) / width;
+        int j = (u / theta_amount) % width;
+
+        for (Primitive *prim: control_set->get_prims_by_goal_heading(theta)) {
+            int vi = i - prim->goal.i;
+            int vj = j - prim->goal.j;
+            if (!map->in_bounds(vi, vj) || !map->traversable(vi, vj))
+                continue;
+            size_t v = state(vi, vj, prim->start_theta);
+            if (dead[v] || !params.check_prim(vi, vj, prim))
+                continue;
+
+            alive_out[v] -= 1;
+            if (alive_out[v] == 0) {  // все допустимые примитивы из v ведут в тупики -> v тоже тупик
+                dead[v] = 1;
+                queue.push_back(v);
+            }
+        }
+    }
+
+    own_bits.assign((states + 63) / 64, 0);
+    for (size_t u: queue)
+        own_bits[u >> 6] |= uint64_t(1) << (u & 63);
+    dead_amount = queue.size();
+    bits = own_bits.data();
+
+    delete params.ast;
+}
+
+
+
+
+#define DEAD_ENDS_MAGIC "KCDEAD\0"  // сигнатура кэша тупиков
+#define DEAD_ENDS_VERSION 1
+
+
+struct DeadEndsHeader {
+    /*
+    Заголовок кэша тупиков. Кэш актуален, если не изменились файл карты (его размер и время изменения) и control set
+    (его контрольная сумма), а контрольная сумма маски совпадает с checksum.
+    */
+
+    char magic[8];
+    uint32_t version;
+    uint32_t height, width, theta_amount;
+    uint64_t dead_amount;
+    uint64_t source_size;
+    int64_t source_mtime;
+    uint64_t control_set_checksum;
+    uint64_t checksum;
+    uint64_t bits;  // смещение маски
+};
+
+
+bool DeadEnds::load_cache(string map_file, string cache_file, uint64_t control_set_checksum) {
+    /*
+    Данная функция пытается загрузить маску из кэша cache_file. Возвращает 0, если кэша нет, он устарел или повреждён.
+    */
+
+    uint64_t size;
+    int64_t mtime;
+    if (!file_stamp(map_file, size, mtime) || !file_starts_with(cache_file, DEAD_ENDS_MAGIC))
+        return 0;
+    if (!mapped.open(cache_file) || mapped.size < sizeof(DeadEndsHeader)) {
+        mapped.close();
+        return 0;
+    }
+
+    const DeadEndsHeader *h = mapped.at <DeadEndsHeader> (0);
+    size_t bits_bytes = ((size_t) h->height * h->width * theta_amount + 63) / 64 * sizeof(uint64_t);
+    bool ok = h->version == DEAD_ENDS_VERSION && (int) h->theta_amount == theta_amount &&
+              h->source_size == size && h->source_mtime == mtime && h->control_set_checksum == control_set_checksum &&
+              h->bits % BINARY_ALIGN == 0 && h->bits + bits_bytes <= mapped.size &&
+              checksum64(mapped.data + h->bits, bits_bytes) == h->checksum;
+    if (!ok) {
+        mapped.close();
+        return 0;
+    }
+
+    height = h->height;
+    width = h->width;
+    dead_amount = h->dead_amount;
+    bits = mapped.at <uint64_t> (h->bits);
+    own_bits.clear();
+    return 1;
+}
+
+
+void DeadEnds::save_cache(string map_file, string cache_file, uint64_t control_set_checksum) {
+    /*
+    Данная функция сохраняет посчитанную маску в кэш cache_file.
+    */
+
+    DeadEndsHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, DEAD_ENDS_MAGIC, 8);
+    h.version = DEAD_ENDS_VERSION;
+    h.height = height;
+    h.width = width;
+    h.theta_amount = theta_amount;
+    h.dead_amount = dead_amount;
+    h.control_set_checksum = control_set_checksum;
+    if (!file_stamp(map_file, h.source_size, h.source_mtime))
+        return;
+
+    BinaryWriter out(sizeof(h));
+    h.bits = out.add_array(bits, own_bits.size());
+    h.checksum = checksum64(bits, own_bits.size() * sizeof(uint64_t));
+    out.save(cache_file, &h, sizeof(h));
+}
+
+
+size_t DeadEnds::state(int i, int j, int theta) {
+    /*
+    Данная функция возвращает номер состояния (i, j, theta) (он же номер его бита в маске).
+    */
+
+    return ((size_t) i * width + j) * theta_amount + theta;
+}
+
+
+bool DeadEnds::is_dead(int i, int j, int theta) {
+    /*
+    Данная функция проверяет, является ли состояние (i, j, theta) тупиковым (клетка (i,j) должна лежать на карте).
+    */
+
+    size_t u = state(i, j, theta);
+    return (bits[u >> 6] >> (u & 63)) & 1;
+}
@@ -2,7 +2,8 @@
 #include "KC_structs.hpp"
 #include "KC_searching.hpp"
 
-extern MyHEAP* HEAP;  // показываем, что где-то в коде будет объявлена глобальная переменная HEAP - экземпляр рукописной "кучи" MyHEAP
+extern thread_local MyHEAP* HEAP;  // показываем, что где-то в коде будет объявлена глобальная переменная HEAP - экземпляр рукописной "кучи" MyHEAP
+                                    // (у каждого потока своя куча, см. KC_server.hpp)
 
 
 
@@ -77,6 +78,15 @@ MyHEAP::MyHEAP() {
 }
 
 
+size_t MyHEAP::used_bytes() {
+    /*
+    Данная функция возвращает, сколько памяти занимают выданные (ещё не удалённые) экземпляры Vertex и SearchNode.
+    */
+
+    return (N - index_free_vertexs.size()) * sizeof(Vertex) + (N - index_free_nodes.size()) * sizeof(SearchNode);
+}
+
+
 void MyHEAP::resize() {
     /*
     Данная функция вызывается, если все имеющиеся экземпляры используются (index_free_... опустел).
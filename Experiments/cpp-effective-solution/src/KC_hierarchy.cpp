@@ -0,0 +1,852 @@
+#include <cstring>
+#include <cmath>
+#include <queue>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <chrono>
+#include <stdexcept>
+
+#include "KC_hierarchy.hpp"
+#include "common.hpp"
+#include "rassert.hpp"
+
+
+
+
+struct WindowSearch {
+    /*
+    Поиск Дейкстры по state lattice внутри окна [i0, i1) x [j0, j1) карты: примитив допустим, если он не задевает
+    препятствия и заканчивается внутри окна. Прямой поиск идёт от источников по последователям (dist - расстояние от
+    источника), обратный - по предшественникам (dist - расстояние до ближайшего источника). Для каждого состояния
+    запоминается номер примитива (среди выходящих под углом начала примитива), по которому в него пришли (в прямом
+    поиске) или по которому из него нужно ехать дальше (в обратном), и состояние на другом конце этого примитива.
+    */
+
+    StateLatticeParams *p;
+    int i0, j0, i1, j1, theta_amount;
+    bool backward;
+    vector <long double> dist;
+    vector <int> link;  // номер примитива
+    vector <int> other;  // номер состояния на другом конце примитива (-1 у источников)
+    priority_queue <pair <long double, int>, vector <pair <long double, int>>, greater <pair <long double, int>>> queue;
+    int steps;  // сколько состояний раскрыто
+
+    static constexpr long double INF = 1e30;  // с -ffast-math настоящая бесконечность не годится
+
+
+    WindowSearch(StateLatticeParams *p, int i0, int j0, int i1, int j1, bool backward) {
+        this->p = p;
+        this->i0 = i0;
+        this->j0 = j0;
+        this->i1 = i1;
+        this->j1 = j1;
+        this->backward = backward;
+        theta_amount = p->control_set->theta_amount;
+        reset();
+    }
+
+
+    void reset() {
+        /*
+        Забываем всё посчитанное (окно то же).
+        */
+
+        size_t states = (size_t) (i1 - i0) * (j1 - j0) * theta_amount;
+        dist.assign(states, INF);
+        link.assign(states, -1);
+        other.assign(states, -1);
+        queue = decltype(queue)();
+        steps = 0;
+    }
+
+
+    bool inside(int i, int j) {
+        return i0 <= i && i < i1 && j0 <= j && j < j1;
+    }
+
+
+    int index(int i, int j, int theta) {
+        return ((i - i0) * (j1 - j0) + (j - j0)) * theta_amount + theta;
+    }
+
+
+    Vertex state(int k) {
+        int theta = k % theta_amount;
+        k /= theta_amount;
+        return Vertex(i0 + k / (j1 - j0), j0 + k % (j1 - j0), theta);
+    }
+
+
+    void add_source(int i, int j, int theta) {
+        int k = index(i, j, theta);
+        dist[k] = 0;
+        queue.push({0, k});
+    }
+
+
+    void relax(int from, int to, int prim, long double cost) {
+        if (dist[from] + cost < dist[to]) {
+            dist[to] = dist[from] + cost;
+            link[to] = prim;
+            other[to] = from;
+            queue.push({dist[to], to});
+        }
+    }
+
+
+    bool run(const vector <int> &targets, SearchLimits &limits) {
+        /*
+        Данная функция раскрывает состояния, пока не будут раскрыты все targets (или пока не кончится очередь).
+        Возвращает 0, если кончилось время.
+        */
+
+        vector <char> is_target(dist.size(), 0);
+        int remaining = 0;
+        for (int t: targets)
+            if (is_target[t] == 0) {
+                is_target[t] = 1;
+                remaining += 1;
+            }
+
+        vector <char> done(dist.size(), 0);
+        ControlSet *control_set = p->control_set;
+        while (remaining > 0 && !queue.empty()) {
+            auto top = queue.top();
+            queue.pop();
+            int k = top.second;
+            if (done[k] || top.first > dist[k])
+                continue;  // устаревшая запись
+            done[k] = 1;
+            remaining -= is_target[k];
+            steps += 1;
+            if (limits.passed(steps))
+                return 0;
+
+            Vertex v = state(k);
+            if (!backward) {
+                vector <Primitive*> &prims = control_set->get_prims_by_heading(v.theta);
+                for (size_t n = 0; n < prims.size(); n ++) {
+                    int i = v.i + prims[n]->goal.i, j = v.j + prims[n]->goal.j;
+                    if (inside(i, j) && p->check_prim(v.i, v.j, prims[n]))
+                        relax(k, index(i, j, prims[n]->goal.theta), n, p->edge_cost(prims[n]));
+                }
+            } else {
+                for (Primitive *prim: control_set->get_prims_by_goal_heading(v.theta)) {
+                    int i = v.i - prim->goal.i, j = v.j - prim->goal.j;  // откуда должен выходить примитив
+                    if (inside(i, j) && p->check_prim(i, j, prim)) {
+                        int n = prim - control_set->get_prims_by_heading(prim->start_theta)[0];  // примитивы одного угла лежат подряд
+                        relax(k, index(i, j, prim->start_theta), n, p->edge_cost(prim));
+                    }
+                }
+            }
+        }
+        return 1;
+    }
+
+
+    void steps_to(int k, vector <uint16_t> &res) {
+        /*
+        Прямой поиск: дописывает в res примитивы пути от источника до состояния k.
+        */
+
+        size_t first = res.size();
+        for (; other[k] != -1; k = other[k])
+            res.push_back(link[k]);
+        reverse(res.begin() + first, res.end());
+    }
+
+
+    void steps_from(int k, vector <uint16_t> &res) {
+        /*
+        Обратный поиск: дописывает в res примитивы пути от состояния k до ближайшего источника.
+        */
+
+        for (; other[k] != -1; k = other[k])
+            res.push_back(link[k]);
+    }
+};
+
+
+static void apply_steps(ControlSet *control_set, const uint16_t *steps, int amount, vector <Vertex> &path) {
+    /*
+    Данная функция продолжает путь path (он не пуст) примитивами steps: k-ый шаг - номер примитива среди выходящих
+    под углом последнего состояния пути.
+    */
+
+    for (int k = 0; k < amount; k ++) {
+        Vertex v = path.back();
+        Primitive *prim = control_set->get_prims_by_heading(v.theta)[steps[k]];
+        path.push_back(Vertex(v.i + prim->goal.i, v.j + prim->goal.j, prim->goal.theta));
+    }
+}
+
+
+
+
+Hierarchy::Hierarchy() {
+    /*
+    Конструктор. Пока абстракция не построена, она пуста.
+    */
+
+    height = width = theta_amount = 0;
+    cluster_size = margin = 0;
+    clusters_h = clusters_w = 0;
+    entrances_amount = 0;
+    entrance_i = entrance_j = entrance_theta = NULL;
+    cluster_begin = cluster_entrances = NULL;
+    edge_begin = edge_to = edge_steps = NULL;
+    edge_cost = NULL;
+    steps = NULL;
+}
+
+
+void Hierarchy::load_or_build(Map *map, ControlSet *control_set, string map_file, string cache_file,
+                              int cluster_size, string mode) {
+    /*
+    Данная функция загружает абстракцию карты map (прочитанной из map_file) для control_set из кэша cache_file, а если
+    кэша нет или он устарел (в том числе построен для другого размера кластера или режима) - строит её и сохраняет в
+    cache_file (если сохранить не удалось, просто работаем без кэша).
+    */
+
+    rassert(mode == "PRIM" || mode == "COST", "Не правильный mode в Hierarchy!");
+    if (cluster_size <= 0)
+        throw runtime_error("Размер кластера должен быть положительным!");
+    this->cluster_size = cluster_size;
+    this->mode = mode;
+    theta_amount = control_set->theta_amount;
+
+    uint64_t control_set_checksum = control_set->checksum();
+    if (load_cache(map_file, cache_file, control_set_checksum))
+        return;
+
+    build(map, control_set);
+    try {
+        save_cache(map_file, cache_file, control_set_checksum);
+    } catch (exception &e) {
+        (void) e;
+    }
+}
+
+
+int Hierarchy::cluster_of(int i, int j) {
+    /*
+    Номер кластера, в котором лежит клетка (i, j).
+    */
+
+    return (i / cluster_size) * clusters_w + j / cluster_size;
+}
+
+
+void Hierarchy::cluster_window(int c, int &i0, int &j0, int &i1, int &j1) {
+    /*
+    Окно кластера c: сам кластер, расширенный на margin клеток (но не за пределы карты), - клетки [i0, i1) x [j0, j1).
+    */
+
+    int ci = c / clusters_w, cj = c % clusters_w;
+    i0 = max(0, ci * cluster_size - margin);
+    j0 = max(0, cj * cluster_size - margin);
+    i1 = min(height, (ci + 1) * cluster_size + margin);
+    j1 = min(width, (cj + 1) * cluster_size + margin);
+}
+
+
+void Hierarchy::find_entrances(Map *map, ControlSet *control_set) {
+    /*
+    Данная функция находит входы на границах всех пар соседних кластеров (см. KC_hierarchy.hpp) и для каждого
+    кластера список его входов.
+    */
+
+    Vertex dummy(0, 0, 0);
+    StateLatticeParams params(&dummy, &dummy, map, control_set, false, mode);  // нужен только ради check_prim
+
+    vector <vector <int>> by_cluster(clusters_h * clusters_w);
+    auto add_cell = [&](int i, int j, bool vertical, int c1, int c2) {  // vertical - граница между столбцами
+        for (int theta = 0; theta < theta_amount; theta ++) {
+            double angle = 2 * M_PI * theta / theta_amount;  // угол 0 - вдоль j
+            double across = vertical ? fabs(cos(angle)) : fabs(sin(angle));
+            if (across < cos(M_PI / 4) + 1e-6)
+                continue;  // направление не пересекает границу
+            bool moves = 0;  // есть ли из состояния хоть один допустимый примитив
+            for (Primitive *prim: control_set->get_prims_by_heading(theta))
+                if (params.check_prim(i, j, prim)) {
+                    moves = 1;
+                    break;
+                }
+            if (!moves)
+                continue;
+            by_cluster[c1].push_back(own_entrance_i.size());
+            by_cluster[c2].push_back(own_entrance_i.size());
+            own_entrance_i.push_back(i);
+            own_entrance_j.push_back(j);
+            own_entrance_theta.push_back(theta);
+        }
+    };
+    auto add_run = [&](int from, int to, auto cell) {  // отрезок [from, to] свободных с обеих сторон клеток границы
+        int len = to - from + 1;
+        if (len < 8) {
+            cell(from + len / 2);
+        } else {
+            cell(from + len / 4);
+            cell(to - len / 4);
+        }
+    };
+
+    for (int ci = 0; ci < clusters_h; ci ++)
+        for (int cj = 0; cj < clusters_w; cj ++) {
+            int c = ci * clusters_w + cj;
+            int i_end = min(height, (ci + 1) * cluster_size), j_end = min(width, (cj + 1) * cluster_size);
+
+            if (cj > 0) {  // граница с левым соседом: клетки (i, jb - 1) и (i, jb), вход - в клетке (i, jb)
+                int jb = cj * cluster_size;
+                int from = -1;
+                for (int i = ci * cluster_size; i <= i_end; i ++) {
+                    bool free = (i < i_end) && map->traversable(i, jb - 1) && map->traversable(i, jb);
+                    if (free && from == -1)
+                        from = i;
+                    if (!free && from != -1) {
+                        add_run(from, i - 1, [&](int ii) { add_cell(ii, jb, true, c - 1, c); });
+                        from = -1;
+                    }
+                }
+            }
+            if (ci > 0) {  // граница с верхним соседом: клетки (ib - 1, j) и (ib, j), вход - в клетке (ib, j)
+                int ib = ci * cluster_size;
+                int from = -1;
+                for (int j = cj * cluster_size; j <= j_end; j ++) {
+                    bool free = (j < j_end) && map->traversable(ib - 1, j) && map->traversable(ib, j);
+                    if (free && from == -1)
+                        from = j;
+                    if (!free && from != -1) {
+                        add_run(from, j - 1, [&](int jj) { add_cell(ib, jj, false, c - clusters_w, c); });
+                        from = -1;
+                    }
+                }
+            }
+        }
+
+    entrances_amount = own_entrance_i.size();
+    own_cluster_begin.assign(1, 0);
+    own_cluster_entrances.clear();
+    for (auto &list: by_cluster) {
+        own_cluster_entrances.insert(own_cluster_entrances.end(), list.begin(), list.end());
+        own_cluster_begin.push_back(own_cluster_entrances.size());
+    }
+
+    delete params.ast;
+}
+
+
+void Hierarchy::build(Map *map, ControlSet *control_set) {
+    /*
+    Данная функция строит абстрактный граф: входы и пути по state lattice между всеми парами входов каждого кластера
+    (прямой поиск Дейкстры от каждого входа внутри окна кластера).
+    */
+
+    height = map->height;
+    width = map->width;
+    clusters_h = (height + cluster_size - 1) / cluster_size;
+    clusters_w = (width + cluster_size - 1) / cluster_size;
+    margin = 0;
+    for (int theta = 0; theta < theta_amount; theta ++)
+        for (Primitive *prim: control_set->get_prims_by_heading(theta)) {
+            margin = max(margin, prim->reach);
+            rassert(control_set->get_prims_by_heading(theta).size() <= 65536, "Слишком много примитивов для Hierarchy!");
+        }
+
+    own_entrance_i.clear();
+    own_entrance_j.clear();
+    own_entrance_theta.clear();
+    find_entrances(map, control_set);
+
+    Vertex dummy(0, 0, 0);
+    StateLatticeParams params(&dummy, &dummy, map, control_set, false, mode);
+    SearchLimits no_limits(0);
+
+    struct Edge {
+        int to;
+        long double cost;
+        vector <uint16_t> steps;
+    };
+    vector <vector <Edge>> edges(entrances_amount);  // рёбра каждого входа (вход лежит в двух кластерах -> собираем из обоих)
+
+    for (int c = 0; c < clusters_h * clusters_w; c ++) {
+        int i0, j0, i1, j1;
+        cluster_window(c, i0, j0, i1, j1);
+        WindowSearch search(&params, i0, j0, i1, j1, false);
+
+        vector <int> targets;
+        for (int n = own_cluster_begin[c]; n < own_cluster_begin[c + 1]; n ++) {
+            int e = own_cluster_entrances[n];
+            targets.push_back(search.index(own_entrance_i[e], own_entrance_j[e], own_entrance_theta[e]));
+        }
+
+        for (int n = own_cluster_begin[c]; n < own_cluster_begin[c + 1]; n ++) {
+            int e = own_cluster_entrances[n];
+            search.reset();
+            search.add_source(own_entrance_i[e], own_entrance_j[e], own_entrance_theta[e]);
+            search.run(targets, no_limits);
+
+            for (int m = own_cluster_begin[c]; m < own_cluster_begin[c + 1]; m ++) {
+                int f = own_cluster_entrances[m];
+                int t = targets[m - own_cluster_begin[c]];
+                if (f == e || search.dist[t] >= WindowSearch::INF)
+                    continue;
+                Edge *same = NULL;  // ребро в f могло уже найтись в другом кластере входа e -> оставляем лучшее
+                for (Edge &edge: edges[e])
+                    if (edge.to == f)
+                        same = &edge;
+                if (same != NULL && same->cost <= search.dist[t])
+                    continue;
+                if (same == NULL) {
+                    edges[e].push_back(Edge());
+                    same = &edges[e].back();
+                }
+                same->to = f;
+                same->cost = search.dist[t];
+                same->steps.clear();
+                search.steps_to(t, same->steps);
+            }
+        }
+    }
+
+    own_edge_begin.assign(1, 0);
+    own_edge_to.clear();
+    own_edge_cost.clear();
+    own_edge_steps.assign(1, 0);
+    own_steps.clear();
+    for (int e = 0; e < entrances_amount; e ++) {
+        for (Edge &edge: edges[e]) {
+            own_edge_to.push_back(edge.to);
+            own_edge_cost.push_back(edge.cost);
+            own_steps.insert(own_steps.end(), edge.steps.begin(), edge.steps.end());
+            own_edge_steps.push_back(own_steps.size());
+        }
+        own_edge_begin.push_back(own_edge_to.size());
+    }
+
+    entrance_i = own_entrance_i.data();
+    entrance_j = own_entrance_j.data();
+    entrance_theta = own_entrance_theta.data();
+    cluster_begin = own_cluster_begin.data();
+    cluster_entrances = own_cluster_entrances.data();
+    edge_begin = own_edge_begin.data();
+    edge_to = own_edge_to.data();
+    edge_cost = own_edge_cost.data();
+    edge_steps = own_edge_steps.data();
+    steps = own_steps.data();
+    mapped.close();
+
+    delete params.ast;
+}
+
+
+bool Hierarchy::abstract_search(StateLatticeParams *params, const vector <pair <int, long double>> &from_start,
+                                const unordered_map <int, long double> &to_goal, long double direct,
+                                vector <int> &chain, vector <int> &chain_edges, long double &cost, int &steps_done) {
+    /*
+    Данная функция ищет A* путь по абстрактному графу: из старта можно попасть во входы from_start (с указанными
+    стоимостями), из входов to_goal - в цель, а direct - стоимость пути из старта сразу в цель (INF, если его нет).
+    В chain записываются входы пути по порядку, в chain_edges - рёбра между соседними входами chain.
+    Возвращает 0, если пути нет.
+    */
+
+    const long double INF = WindowSearch::INF;
+    int goal = entrances_amount;  // "виртуальная" цель
+    unordered_map <int, long double> g;
+    unordered_map <int, pair <int, int>> parent;  // вершина -> (откуда пришли, номер ребра); -1 - из старта
+    priority_queue <pair <long double, int>, vector <pair <long double, int>>, greater <pair <long double, int>>> open;
+    auto get_g = [&](int v) {
+        auto it = g.find(v);
+        return it == g.end() ? INF : it->second;
+    };
+    auto relax = [&](int v, long double value, int from, int edge) {
+        if (value >= get_g(v))
+            return;
+        g[v] = value;
+        parent[v] = {from, edge};
+        long double h = 0;
+        if (v != goal) {
+            ptrVertex u = HEAP->new_Vertex(entrance_i[v], entrance_j[v], entrance_theta[v]);
+            h = params->heuristic(u);
+            HEAP->delete_Vertex(u);
+        }
+        open.push({value + h, v});
+    };
+
+    for (auto &link: from_start)
+        relax(link.first, link.second, -1, -1);
+    if (direct < INF)
+        relax(goal, direct, -1, -1);
+
+    unordered_set <int> closed;
+    while (!open.empty()) {
+        int v = open.top().second;
+        open.pop();
+        if (closed.count(v))
+            continue;
+        closed.insert(v);
+        steps_done += 1;
+        if (v == goal)
+            break;
+
+        auto link = to_goal.find(v);
+        if (link != to_goal.end())
+            relax(goal, get_g(v) + link->second, v, -1);
+        for (int e = edge_begin[v]; e < edge_begin[v + 1]; e ++)
+            if (closed.count(edge_to[e]) == 0)
+                relax(edge_to[e], get_g(v) + edge_cost[e], v, e);
+    }
+    if (closed.count(goal) == 0)
+        return 0;
+
+    chain.clear();
+    chain_edges.clear();
+    for (int v = parent[goal].first; v != -1; v = parent[v].first) {
+        chain.push_back(v);
+        if (parent[v].first != -1)
+            chain_edges.push_back(parent[v].second);
+    }
+    reverse(chain.begin(), chain.end());
+    reverse(chain_edges.begin(), chain_edges.end());
+    cost = g[goal];
+    return 1;
+}
+
+
+ResultHierarchy Hierarchy::find_path(Map *map, ControlSet *control_set, Vertex *start, Vertex *finish,
+                                     long double R, int A, double time_budget) {
+    /*
+    Данная функция ищет путь от start до целевых состояний (в радиусе R от finish, с углом, отличающимся не больше, чем
+    на A) по абстракции. Ограничение времени time_budget (в секундах) - общее на все поиски. Карта и control set должны
+    быть те же, по которым абстракция строилась.
+    Сначала абстрактный путь ищется с оценками (эвристикой) вместо путей от старта до входов и от входов до цели -
+    это ничего не стоит, - и путь уточняется A* по state lattice только внутри окон кластеров, через которые проходит
+    абстрактный путь. Если в этом коридоре пути не нашлось, то пути от старта и до цели ищутся честно (в окнах
+    кластеров старта и финиша), и путь склеивается из них и сохранённых путей по рёбрам.
+    */
+
+    rassert(map->height == height && map->width == width && control_set->theta_amount == theta_amount,
+            "Hierarchy построена для другой карты или control set!");
+
+    ResultHierarchy res;
+    res.find_path = 0;
+    res.out_of_time = 0;
+    res.steps = res.abstract_steps = 0;
+    res.cost = -1;
+
+    auto t0 = chrono::steady_clock::now();
+    auto time_left = [&]() {  // сколько осталось времени (0 - ограничения нет)
+        if (time_budget <= 0)
+            return 0.0;
+        double passed = chrono::duration <double> (chrono::steady_clock::now() - t0).count();
+        return max(time_budget - passed, 1e-9);
+    };
+    auto estimate = [&](int i1, int j1, int i2, int j2) -> long double {  // как эвристика StateLatticeParams
+        long double di = abs(i1 - i2), dj = abs(j1 - j2);
+        if (mode == "PRIM")
+            return sqrtl(di * di + dj * dj);
+        return max(di, dj) + (sqrtl(2) - 1) * min(di, dj);
+    };
+
+    const long double INF = WindowSearch::INF;
+    int sc = cluster_of(start->i, start->j), gc = cluster_of(finish->i, finish->j);
+    vector <int> chain, chain_edges;
+    long double cost;
+
+    // === абстрактный путь по оценкам и уточнение в коридоре ===
+    vector <pair <int, long double>> from_start;
+    unordered_map <int, long double> to_goal;
+    for (int n = cluster_begin[sc]; n < cluster_begin[sc + 1]; n ++) {
+        int e = cluster_entrances[n];
+        from_start.push_back({e, estimate(start->i, start->j, entrance_i[e], entrance_j[e])});
+    }
+    for (int n = cluster_begin[gc]; n < cluster_begin[gc + 1]; n ++) {
+        int e = cluster_entrances[n];
+        to_goal[e] = estimate(entrance_i[e], entrance_j[e], finish->i, finish->j);
+    }
+    long double direct = (sc == gc) ? estimate(start->i, start->j, finish->i, finish->j) : INF;
+
+    StateLatticeParams *params = new StateLatticeParams(start, finish, map, control_set, true, mode, R, A);
+    if (abstract_search(params, from_start, to_goal, direct, chain, chain_edges, cost, res.abstract_steps)) {
+        vector <uint8_t> area((size_t) height * width, 0);  // коридор: окна кластеров старта, финиша и входов пути
+        auto add_cluster = [&](int i, int j) {
+            if (i < 0 || j < 0)
+                return;
+            int i0, j0, i1, j1;
+            cluster_window(cluster_of(i, j), i0, j0, i1, j1);
+            for (int ii = i0; ii < i1; ii ++)
+                memset(area.data() + (size_t) ii * width + j0, 1, j1 - j0);
+        };
+        add_cluster(start->i, start->j);
+        add_cluster(finish->i, finish->j);
+        for (int e: chain) {  // вход лежит в двух кластерах: в своём и в соседнем сверху или слева
+            add_cluster(entrance_i[e], entrance_j[e]);
+            add_cluster(entrance_i[e] - 1, entrance_j[e]);
+            add_cluster(entrance_i[e], entrance_j[e] - 1);
+        }
+
+        params->area = area.data();
+        ResultSearch found = AstarSearch(params, time_left());
+        res.steps += found.steps;
+        if (found.out_of_time) {
+            res.out_of_time = 1;
+        } else if (found.find_path) {
+            for (ptrSearchNode node = found.final_node; !(node == NULL_Node); node = node->parent)
+                res.path.push_back(Vertex(node->vertex->i, node->vertex->j, node->vertex->theta));
+            reverse(res.path.begin(), res.path.end());
+            res.cost = found.final_node->g;
+            res.find_path = 1;
+            HEAP->delete_SearchNode(found.final_node);  // последняя вершина не лежит ни в OPEN, ни в CLOSED
+        }
+    }
+    delete params->ast;
+    delete params;
+    if (res.find_path || res.out_of_time)
+        return res;
+
+    // === честные пути от старта до входов и от входов до цели, склеивание ===
+    StateLatticeParams local(start, finish, map, control_set, false, mode, R, A);  // is_goal и check_prim
+    int i0, j0, i1, j1;
+    cluster_window(sc, i0, j0, i1, j1);
+    WindowSearch forward(&local, i0, j0, i1, j1, false);  // от старта до входов кластера старта
+    cluster_window(gc, i0, j0, i1, j1);
+    WindowSearch backward(&local, i0, j0, i1, j1, true);  // от входов кластера финиша до целевых состояний
+
+    vector <int> goal_states;  // целевые состояния в окне кластера финиша
+    int r = (int) R + 1;
+    for (int i = finish->i - r; i <= finish->i + r; i ++)
+        for (int j = finish->j - r; j <= finish->j + r; j ++) {
+            if (!backward.inside(i, j) || !map->traversable(i, j))
+                continue;
+            for (int theta = 0; theta < theta_amount; theta ++) {
+                ptrVertex v = HEAP->new_Vertex(i, j, theta);
+                if (local.is_goal(v)) {
+                    goal_states.push_back(backward.index(i, j, theta));  // при sc == gc окна совпадают -> номера тоже
+                    backward.add_source(i, j, theta);
+                }
+                HEAP->delete_Vertex(v);
+            }
+        }
+
+    auto entrance_states = [&](WindowSearch &search, int c) {
+        vector <int> states;
+        for (int n = cluster_begin[c]; n < cluster_begin[c + 1]; n ++) {
+            int e = cluster_entrances[n];
+            states.push_back(search.index(entrance_i[e], entrance_j[e], entrance_theta[e]));
+        }
+        return states;
+    };
+
+    vector <int> forward_targets = entrance_states(forward, sc);
+    if (sc == gc)  // старт и финиш в одном кластере -> путь может и не выходить из него
+        forward_targets.insert(forward_targets.end(), goal_states.begin(), goal_states.end());
+    forward.add_source(start->i, start->j, start->theta);
+    SearchLimits limits(time_left());
+    bool in_time = forward.run(forward_targets, limits) && backward.run(entrance_states(backward, gc), limits);
+    res.steps += forward.steps + backward.steps;
+    if (!in_time) {
+        res.out_of_time = 1;
+        delete local.ast;
+        return res;
+    }
+
+    from_start.clear();
+    to_goal.clear();
+    for (int n = cluster_begin[sc]; n < cluster_begin[sc + 1]; n ++) {
+        int e = cluster_entrances[n];
+        int k = forward.index(entrance_i[e], entrance_j[e], entrance_theta[e]);
+        if (forward.dist[k] < INF)
+            from_start.push_back({e, forward.dist[k]});
+    }
+    for (int n = cluster_begin[gc]; n < cluster_begin[gc + 1]; n ++) {
+        int e = cluster_entrances[n];
+        int k = backward.index(entrance_i[e], entrance_j[e], entrance_theta[e]);
+        if (backward.dist[k] < INF)
+            to_goal[e] = backward.dist[k];
+    }
+    int best_direct = -1;  // лучшее целевое состояние, до которого доехали, не выходя из кластера
+    if (sc == gc)
+        for (int k: goal_states)
+            if (forward.dist[k] < INF && (best_direct == -1 || forward.dist[k] < forward.dist[best_direct]))
+                best_direct = k;
+    direct = (best_direct == -1) ? INF : forward.dist[best_direct];
+
+    if (abstract_search(&local, from_start, to_goal, direct, chain, chain_edges, cost, res.abstract_steps)) {
+        res.path.push_back(*start);
+        vector <uint16_t> piece;
+        if (chain.empty())
+            forward.steps_to(best_direct, piece);
+        else
+            forward.steps_to(forward.index(entrance_i[chain[0]], entrance_j[chain[0]], entrance_theta[chain[0]]), piece);
+        apply_steps(control_set, piece.data(), piece.size(), res.path);
+        for (int e: chain_edges)
+            apply_steps(control_set, steps + edge_steps[e], edge_steps[e + 1] - edge_steps[e], res.path);
+        if (!chain.empty()) {
+            int last = chain.back();
+            piece.clear();
+            backward.steps_from(backward.index(entrance_i[last], entrance_j[last], entrance_theta[last]), piece);
+            apply_steps(control_set, piece.data(), piece.size(), res.path);
+        }
+        res.find_path = 1;
+        res.cost = cost;
+    }
+
+    delete local.ast;
+    return res;
+}
+
+
+
+
+#define HIERARCHY_MAGIC "KCHPA\0\0"  // сигнатура кэша абстракции
+#define HIERARCHY_VERSION 1
+
+
+struct HierarchyHeader {
+    /*
+    Заголовок кэша абстракции. Кэш актуален, если не изменились файл карты (его размер и время изменения) и control set
+    (его контрольная сумма), совпадают размер кластера и режим, а контрольная сумма массивов совпадает с checksum.
+    */
+
+    char magic[8];
+    uint32_t version;
+    uint32_t height, width, theta_amount;
+    uint32_t cluster_size, margin;
+    uint32_t prim_mode;  // 1 - PRIM, 0 - COST
+    uint32_t entrances_amount, edges_amount, steps_amount;
+    uint64_t source_size;
+    int64_t source_mtime;
+    uint64_t control_set_checksum;
+    uint64_t checksum;
+    // смещения массивов:
+    uint64_t entrance_i, entrance_j, entrance_theta, cluster_begin, cluster_entrances;
+    uint64_t edge_begin, edge_to, edge_cost, edge_steps, steps;
+};
+
+
+static uint64_t hierarchy_checksum(const Hierarchy &h, size_t clusters, size_t edges, size_t steps_amount) {
+    /*
+    Контрольная сумма всех массивов абстракции.
+    */
+
+    uint64_t parts[] = {checksum64(h.entrance_i, h.entrances_amount * sizeof(int)),
+                        checksum64(h.entrance_j, h.entrances_amount * sizeof(int)),
+                        checksum64(h.entrance_theta, h.entrances_amount * sizeof(int)),
+                        checksum64(h.cluster_begin, (clusters + 1) * sizeof(int)),
+                        checksum64(h.cluster_entrances, h.cluster_begin[clusters] * sizeof(int)),
+                        checksum64(h.edge_begin, (h.entrances_amount + 1) * sizeof(int)),
+                        checksum64(h.edge_to, edges * sizeof(int)),
+                        checksum64(h.edge_cost, edges * sizeof(long double)),
+                        checksum64(h.edge_steps, (edges + 1) * sizeof(int)),
+                        checksum64(h.steps, steps_amount * sizeof(uint16_t))};
+    return checksum64(parts, sizeof(parts));
+}
+
+
+bool Hierarchy::load_cache(string map_file, string cache_file, uint64_t control_set_checksum) {
+    /*
+    Данная функция пытается загрузить абстракцию из кэша cache_file. Возвращает 0, если кэша нет, он устарел или повреждён.
+    */
+
+    uint64_t size;
+    int64_t mtime;
+    if (!file_stamp(map_file, size, mtime) || !file_starts_with(cache_file, HIERARCHY_MAGIC))
+        return 0;
+    if (!mapped.open(cache_file) || mapped.size < sizeof(HierarchyHeader)) {
+        mapped.close();
+        return 0;
+    }
+
+    const HierarchyHeader *h = mapped.at <HierarchyHeader> (0);
+    size_t clusters = (size_t) ((h->height + h->cluster_size - 1) / max(h->cluster_size, 1u)) *
+                      ((h->width + h->cluster_size - 1) / max(h->cluster_size, 1u));
+    bool ok = h->version == HIERARCHY_VERSION && (int) h->theta_amount == theta_amount &&
+              (int) h->cluster_size == cluster_size && h->prim_mode == (uint32_t) (mode == "PRIM") &&
+              h->source_size == size && h->source_mtime == mtime && h->control_set_checksum == control_set_checksum;
+    // все массивы должны целиком лежать в файле:
+    pair <uint64_t, size_t> arrays[] = {{h->entrance_i, h->entrances_amount * sizeof(int)},
+                                        {h->entrance_j, h->entrances_amount * sizeof(int)},
+                                        {h->entrance_theta, h->entrances_amount * sizeof(int)},
+                                        {h->cluster_begin, (clusters + 1) * sizeof(int)},
+                                        {h->edge_begin, (h->entrances_amount + 1) * sizeof(int)},
+                                        {h->edge_to, h->edges_amount * sizeof(int)},
+                                        {h->edge_cost, h->edges_amount * sizeof(long double)},
+                                        {h->edge_steps, (h->edges_amount + 1) * sizeof(int)},
+                                        {h->steps, h->steps_amount * sizeof(uint16_t)}};
+    for (auto &a: arrays)
+        ok = ok && a.first % BINARY_ALIGN == 0 && a.first + a.second <= mapped.size;
+    if (ok) {
+        const int *begin = mapped.at <int> (h->cluster_begin);
+        ok = h->cluster_entrances % BINARY_ALIGN == 0 &&
+             h->cluster_entrances + (size_t) begin[clusters] * sizeof(int) <= mapped.size;
+    }
+    if (!ok) {
+        mapped.close();
+        return 0;
+    }
+
+    height = h->height;
+    width = h->width;
+    margin = h->margin;
+    clusters_h = (height + cluster_size - 1) / cluster_size;
+    clusters_w = (width + cluster_size - 1) / cluster_size;
+    entrances_amount = h->entrances_amount;
+    entrance_i = mapped.at <int> (h->entrance_i);
+    entrance_j = mapped.at <int> (h->entrance_j);
+    entrance_theta = mapped.at <int> (h->entrance_theta);
+    cluster_begin = mapped.at <int> (h->cluster_begin);
+    cluster_entrances = mapped.at <int> (h->cluster_entrances);
+    edge_begin = mapped.at <int> (h->edge_begin);
+    edge_to = mapped.at <int> (h->edge_to);
+    edge_cost = mapped.at <long double> (h->edge_cost);
+    edge_steps = mapped.at <int> (h->edge_steps);
+    steps = mapped.at <uint16_t> (h->steps);
+    if (hierarchy_checksum(*this, clusters, h->edges_amount, h->steps_amount) != h->checksum) {
+        mapped.close();
+        return 0;
+    }
+
+    own_entrance_i.clear(); own_entrance_j.clear(); own_entrance_theta.clear();
+    own_cluster_begin.clear(); own_cluster_entrances.clear();
+    own_edge_begin.clear(); own_edge_to.clear(); own_edge_cost.clear(); own_edge_steps.clear(); own_steps.clear();
+    return 1;
+}
+
+
+void Hierarchy::save_cache(string map_file, string cache_file, uint64_t control_set_checksum) {
+    /*
+    Данная функция сохраняет построенную абстракцию в кэш cache_file.
+    */
+
+    HierarchyHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, HIERARCHY_MAGIC, 8);
+    h.version = HIERARCHY_VERSION;
+    h.height = height;
+    h.width = width;
+    h.theta_amount = theta_amount;
+    h.cluster_size = cluster_size;
+    h.margin = margin;
+    h.prim_mode = (mode == "PRIM");
+    h.entrances_amount = entrances_amount;
+    h.edges_amount = own_edge_to.size();
+    h.steps_amount = own_steps.size();
+    h.control_set_checksum = control_set_checksum;
+    if (!file_stamp(map_file, h.source_size, h.source_mtime))
+        return;
+
+    BinaryWriter out(sizeof(h));
+    h.entrance_i = out.add_array(entrance_i, entrances_amount);
+    h.entrance_j = out.add_array(entrance_j, entrances_amount);
+    h.entrance_theta = out.add_array(entrance_theta, entrances_amount);
+    h.cluster_begin = out.add_array(cluster_begin, own_cluster_begin.size());
+    h.cluster_entrances = out.add_array(cluster_entrances, own_cluster_entrances.size());
+    h.edge_begin = out.add_array(edge_begin, own_edge_begin.size());
+    h.edge_to = out.add_array(edge_to, own_edge_to.size());
+    h.edge_cost = out.add_array(edge_cost, own_edge_cost.size());
+    h.edge_steps = out.add_array(edge_steps, own_edge_steps.size());
+    h.steps = out.add_array(steps, own_steps.size());
+    h.checksum = hierarchy_checksum(*this, own_cluster_begin.size() - 1, own_edge_to.size(), own_steps.size());
+    out.save(cache_file, &h, sizeof(h));
+}
@@ -0,0 +1,147 @@
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "KC_mmap.hpp"
+
+
+
+
+MappedFile::MappedFile() {
+    data = NULL;
+    size = 0;
+}
+
+
+bool MappedFile::open(string file) {
+    /*
+    Данная функция отображает файл file в память. Возвращает 0, если файл открыть не удалось.
+    */
+
+    close();
+
+    int fd = ::open(file.c_str(), O_RDONLY);
+    if (fd < 0)
+        return 0;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        return 0;
+    }
+
+    void *ptr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // после mmap дескриптор больше не нужен (отображение остаётся)
+    if (ptr == MAP_FAILED)
+        return 0;
+
+    data = (const uint8_t *) ptr;
+    size = st.st_size;
+    return 1;
+}
+
+
+void MappedFile::close() {
+    /*
+    Убираем отображение файла из памяти (если оно было).
+    */
+
+    if (data != NULL)
+        munmap((void *) data, size);
+    data = NULL;
+    size = 0;
+}
+
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+
+bool file_starts_with(string file, const char *magic) {
+    /*
+    Данная функция проверяет, начинается ли файл file с 8-байтовой сигнатуры magic (так отличаем
+    скомпилированные бинарные файлы от текстовых).
+    */
+
+    FILE *f = fopen(file.c_str(), "rb");
+    if (f == NULL)
+        return 0;
+
+    char buf[8];
+    bool ok = (fread(buf, 1, 8, f) == 8 && memcmp(buf, magic, 8) == 0);
+    fclose(f);
+    return ok;
+}
+
+
+bool file_stamp(string file, uint64_t &size, int64_t &mtime) {
+    /*
+    Данная функция получает размер и время последнего изменения (в наносекундах) файла file.
+    Возвращает 0, если такого файла нет.
+    */
+
+    struct stat st;
+    if (stat(file.c_str(), &st) != 0)
+        return 0;
+    size = st.st_size;
+    mtime = (int64_t) st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+    return 1;
+}
+
+
+uint64_t checksum64(const void *data, size_t size) {
+    /*
+    Данная функция считает 64-битную контрольную сумму size байт, начиная с data (вариант FNV-1a, который
+    для скорости обрабатывает сразу по 8 байт).
+    */
+
+    const uint8_t *bytes = (const uint8_t *) data;
+    uint64_t hash = 14695981039346656037ULL;
+    size_t k = 0;
+    for (; k + 8 <= size; k += 8) {
+        uint64_t word;
+        memcpy(&word, bytes + k, 8);
+        hash = (hash ^ word) * 1099511628211ULL;
+        hash ^= hash >> 29;
+    }
+    for (; k < size; k ++)
+        hash = (hash ^ bytes[k]) * 1099511628211ULL;
+    return hash;
+}
+
+
+
+
+BinaryWriter::BinaryWriter(size_t header_size) {
+    /*
+    Конструктор. Резервируем в начале место под заголовок (он записывается в самом конце, когда известны все смещения).
+    */
+
+    bytes.assign(header_size, 0);
+}
+
+
+void BinaryWriter::save(string file, const void *header, size_t header_size) {
+    /*
+    Данная функция записывает заголовок header в начало и сохраняет всё в файл file.
+    Запись идёт во временный файл, который затем переименовывается в file: так другой процесс, который
+    одновременно читает (или тоже записывает) тот же файл, никогда не увидит его недописанным.
+    */
+
+    memcpy(bytes.data(), header, header_size);
+
+    string temp = file + ".tmp" + to_string(getpid());
+    FILE *f = fopen(temp.c_str(), "wb");
+    if (f == NULL)
+        throw runtime_error("Не удалось открыть файл для записи: " + file);
+    bool ok = (fwrite(bytes.data(), 1, bytes.size(), f) == bytes.size());
+    ok = (fclose(f) == 0) && ok;
+    if (!ok || rename(temp.c_str(), file.c_str()) != 0) {
+        remove(temp.c_str());
+        throw runtime_error("Не удалось записать файл: " + file);
+    }
+}
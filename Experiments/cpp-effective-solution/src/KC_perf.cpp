@@ -0,0 +1,139 @@
+#include "KC_perf.hpp"
+
+#if defined(PERF_COUNTERS) && defined(__linux__)
+    #include <cstring>
+    #include <unistd.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <linux/perf_event.h>
+    #define USE_PERF_EVENTS  // счётчики и правда будут открываться
+#endif
+
+
+
+
+#ifdef USE_PERF_EVENTS
+static int open_counter(int num) {
+    /*
+    Данная функция открывает счётчик с номером num (такты, инструкции, промахи L1d, LLC, ветвлений и dTLB - в
+    таком порядке) для текущего процесса на любом ядре.
+    Возвращает файловый дескриптор счётчика или -1, если его открыть не удалось.
+    */
+
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.disabled = 1;  // счётчик включается только в start()
+    attr.exclude_kernel = 1;  // считаем только код программы (так счётчики доступны при perf_event_paranoid <= 2)
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;  // (см. read_counter)
+
+    // для кэшей конфигурация собирается из трёх частей: какой кэш, какая операция (чтение) и какой результат (промах)
+    const unsigned long long read_miss = (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+    switch (num) {
+        case 0: attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_CPU_CYCLES; break;
+        case 1: attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+        case 2: attr.type = PERF_TYPE_HW_CACHE; attr.config = PERF_COUNT_HW_CACHE_L1D | read_miss; break;
+        case 3: attr.type = PERF_TYPE_HW_CACHE; attr.config = PERF_COUNT_HW_CACHE_LL | read_miss; break;
+        case 4: attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+        case 5: attr.type = PERF_TYPE_HW_CACHE; attr.config = PERF_COUNT_HW_CACHE_DTLB | read_miss; break;
+        default: return -1;
+    }
+
+    return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);  // pid = 0 (текущий процесс), cpu = -1 (любое ядро)
+}
+
+
+static bool read_counter(int fd, unsigned long long data[3]) {
+    /*
+    Данная функция читает счётчик fd: data[0] - значение, data[1] - сколько наносекунд событие было включено,
+    data[2] - сколько из них оно реально считалось (меньше data[1], если ядро мультиплексирует события).
+    */
+
+    return read(fd, data, 3 * sizeof(unsigned long long)) == 3 * sizeof(unsigned long long);
+}
+#endif
+
+
+
+
+PerfCounters::PerfCounters() {
+    /*
+    Конструктор. Пытается открыть все счётчики; те, что открыть не удалось, просто не используются.
+    */
+
+    available = 0;
+    for (int k = 0; k < PERF_EVENTS_NUM; k ++) {
+        fds[k] = -1;
+        values[k] = -1;
+        running_share[k] = 0;
+        enabled_at_start[k] = running_at_start[k] = 0;
+#ifdef USE_PERF_EVENTS
+        fds[k] = open_counter(k);
+        if (fds[k] >= 0)
+            available = 1;
+#endif
+    }
+}
+
+
+void PerfCounters::start() {
+    /*
+    Обнуляем и запускаем все открытые счётчики. Время включения и работы счётчика сброс не обнуляет, поэтому
+    запоминаем их текущие значения.
+    */
+
+#ifdef USE_PERF_EVENTS
+    for (int k = 0; k < PERF_EVENTS_NUM; k ++) {
+        if (fds[k] < 0)
+            continue;
+        ioctl(fds[k], PERF_EVENT_IOC_RESET, 0);
+        unsigned long long data[3];
+        if (read_counter(fds[k], data)) {
+            enabled_at_start[k] = data[1];
+            running_at_start[k] = data[2];
+        }
+        ioctl(fds[k], PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+
+void PerfCounters::stop() {
+    /*
+    Останавливаем все открытые счётчики и считываем их значения в values (масштабированные на долю времени, которую
+    счётчик реально считал; если он не считал вовсе - значение неизвестно, -1).
+    */
+
+#ifdef USE_PERF_EVENTS
+    for (int k = 0; k < PERF_EVENTS_NUM; k ++) {
+        if (fds[k] < 0)
+            continue;
+        ioctl(fds[k], PERF_EVENT_IOC_DISABLE, 0);
+        unsigned long long data[3];
+        values[k] = -1;
+        running_share[k] = 0;
+        if (!read_counter(fds[k], data))
+            continue;
+        unsigned long long enabled = data[1] - enabled_at_start[k], running = data[2] - running_at_start[k];
+        if (running == 0)
+            continue;
+        running_share[k] = (double) running / enabled;
+        values[k] = (running == enabled) ? (long long) data[0] : (long long) ((long double) data[0] * enabled / running);
+    }
+#endif
+}
+
+
+PerfCounters::~PerfCounters() {
+    /*
+    Деструктор. Закрывает открытые счётчики.
+    */
+
+#ifdef USE_PERF_EVENTS
+    for (int k = 0; k < PERF_EVENTS_NUM; k ++)
+        if (fds[k] >= 0)
+            close(fds[k]);
+#endif
+}
@@ -0,0 +1,328 @@
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "KC_results.hpp"
+#include "rassert.hpp"
+
+
+
+
+ResultRecord::ResultRecord() {
+    /*
+    Конструктор. Заполняем запись значениями по умолчанию.
+    */
+
+    test = 0;
+    start_i = start_j = start_theta = 0;
+    goal_i = goal_j = goal_theta = 0;
+    param = 0;
+    find_path = 0;
+    rejected = 0;
+    steps = 0;
+    cost = -1;
+    time = 0;
+    for (int k = 0; k < PERF_EVENTS_NUM; k ++)
+        perf[k] = -1;
+}
+
+
+
+
+struct RecordField {
+    /*
+    Одно поле (= столбец) записи: имя и значение одного из трёх видов - целое число, вещественное число или строка.
+    */
+
+    const char *name;
+    int kind;  // 0 - целое (ival), 1 - вещественное (dval), 2 - строка (sval)
+    int group;  // 0 - описание теста и результат, 1 - статистика поиска, 2 - аппаратные счётчики
+    long long ival;
+    double dval;
+    string sval;
+};
+
+
+static void get_fields(const ResultRecord &r, vector <RecordField> &fields) {
+    /*
+    Данная функция раскладывает запись r на список полей. Это единственное место, где перечислены столбцы
+    результатов - по нему строятся и заголовок CSV, и ключи JSON, и столбцы бинарного формата.
+    */
+
+    static const char *perf_names[PERF_EVENTS_NUM] = {"perf_cycles", "perf_instructions", "perf_L1d_misses",
+                                                      "perf_LLC_misses", "perf_branch_misses", "perf_dTLB_misses"};
+
+    fields.clear();
+    fields.push_back({"test", 0, 0, r.test, 0, ""});
+    fields.push_back({"start_i", 0, 0, r.start_i, 0, ""});
+    fields.push_back({"start_j", 0, 0, r.start_j, 0, ""});
+    fields.push_back({"start_theta", 0, 0, r.start_theta, 0, ""});
+    fields.push_back({"goal_i", 0, 0, r.goal_i, 0, ""});
+    fields.push_back({"goal_j", 0, 0, r.goal_j, 0, ""});
+    fields.push_back({"goal_theta", 0, 0, r.goal_theta, 0, ""});
+    fields.push_back({"algorithm", 2, 0, 0, 0, r.algorithm});
+    fields.push_back({"param", 0, 0, r.param, 0, ""});
+    fields.push_back({"find_path", 0, 0, r.find_path, 0, ""});
+    fields.push_back({"rejected", 0, 0, r.rejected, 0, ""});
+    fields.push_back({"steps", 0, 0, r.steps, 0, ""});
+    fields.push_back({"cost", 1, 0, 0, r.cost, ""});
+    fields.push_back({"time", 1, 0, 0, r.time, ""});
+    fields.push_back({"generated", 0, 1, r.stats.generated, 0, ""});
+    fields.push_back({"expanded", 0, 1, r.stats.expanded, 0, ""});
+    fields.push_back({"duplicates", 0, 1, r.stats.duplicates, 0, ""});
+    fields.push_back({"pruned_closed", 0, 1, r.stats.pruned_closed, 0, ""});
+    fields.push_back({"pruned_dead_ends", 0, 1, r.stats.pruned_dead_ends, 0, ""});
+    fields.push_back({"peak_open", 0, 1, r.stats.peak_open, 0, ""});
+    fields.push_back({"peak_pool", 0, 1, r.stats.peak_pool, 0, ""});
+    fields.push_back({"check_prim_calls", 0, 1, r.stats.check_prim_calls, 0, ""});
+    fields.push_back({"collision_cells", 0, 1, r.stats.collision_cells, 0, ""});
+    for (int k = 0; k < PERF_EVENTS_NUM; k ++)
+        fields.push_back({perf_names[k], 0, 2, r.perf[k], 0, ""});
+}
+
+
+
+
+ResultWriter::ResultWriter(string file_name, string format) {
+    /*
+    Конструктор. Открывает файл file_name для записи в формате format и запускает фоновый поток.
+    */
+
+    rassert(format == "CSV" || format == "JSONL" || format == "BIN" || format == "TXT", "Неизвестный формат результатов!");
+    this->format = format;
+    finished = 0;
+    last_test = -1;
+
+    file = fopen(file_name.c_str(), (format == "BIN") ? "wb" : "w");
+    if (file == NULL)
+        throw runtime_error("Не удалось открыть файл для результатов: " + file_name);
+    setvbuf(file, NULL, _IOFBF, 1 << 20);  // большой буфер - в файл пишем редко и крупными кусками
+
+    if (format == "CSV") {  // заголовок таблицы
+        vector <RecordField> fields;
+        get_fields(ResultRecord(), fields);
+        for (size_t k = 0; k < fields.size(); k ++)
+            fprintf(file, "%s%s", fields[k].name, (k + 1 < fields.size()) ? "," : "\n");
+    }
+
+    worker = thread(&ResultWriter::worker_loop, this);
+}
+
+
+void ResultWriter::write(const ResultRecord &record) {
+    /*
+    Данная функция добавляет запись record в буфер (сама запись в файл произойдёт в фоновом потоке).
+    */
+
+    {
+        lock_guard <mutex> guard(lock);
+        pending.push_back(record);
+    }
+    has_work.notify_one();
+}
+
+
+void ResultWriter::worker_loop() {
+    /*
+    Функция фонового потока: забирает накопившиеся записи из pending и пишет их в файл, пока основной
+    поток не вызовет close().
+    */
+
+    vector <ResultRecord> batch;
+    string out;
+
+    while (1) {
+        bool stop;
+        {
+            unique_lock <mutex> guard(lock);
+            has_work.wait(guard, [this]() { return finished || !pending.empty(); });
+            batch.swap(pending);  // забираем всё накопившееся за один раз, основной поток дальше пишет в пустой вектор
+            stop = finished;
+        }
+
+        for (ResultRecord &record: batch) {
+            if (format == "BIN") {
+                all_records.push_back(record);
+                continue;
+            }
+            out.clear();
+            format_record(record, out);
+            fwrite(out.data(), 1, out.size(), file);
+        }
+        batch.clear();
+
+        if (stop)
+            break;
+    }
+
+    if (format == "BIN")
+        write_binary();
+}
+
+
+static void append_number(string &out, long long x) {
+    out += to_string(x);
+}
+
+
+static void append_number(string &out, double x) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.10g", x);
+    out += buf;
+}
+
+
+void ResultWriter::format_record(const ResultRecord &r, string &out) {
+    /*
+    Данная функция форматирует запись r в текстовом формате (CSV, JSONL или TXT) и дописывает её в строку out.
+    */
+
+    if (format == "TXT") {  // старый формат: заголовок теста и по паре строк result/time на каждый алгоритм
+        if (r.test != last_test) {
+            last_test = r.test;
+            out += "=== Test: " + to_string(r.test) + " ===\n";
+            out += "start: " + to_string(r.start_i) + " " + to_string(r.start_j) + " " + to_string(r.start_theta) + "\n";
+            out += "goal: " + to_string(r.goal_i) + " " + to_string(r.goal_j) + " " + to_string(r.goal_theta) + "\n";
+            out += "---\n";
+        }
+        string time_name = (r.algorithm == "PRIM") ? "PRIMS" : r.algorithm;
+        if (r.param != 0)
+            time_name += " " + to_string(r.param);
+
+        out += "result " + r.algorithm + ": " + to_string(r.find_path) + " " + to_string(r.steps) + " ";
+        append_number(out, r.cost);
+        out += "\ntime " + time_name + ": ";
+        append_number(out, r.time);
+        out += "\n";
+
+        // после пары строк result/time - статистика и счётчики (если они собирались)
+        vector <RecordField> fields;
+        get_fields(r, fields);
+#ifdef SEARCH_STATS
+        out += "stats " + time_name + ":";
+        for (RecordField &field: fields)
+            if (field.group == 1)
+                out += " " + string(field.name) + " " + to_string(field.ival);
+        out += "\n";
+#endif
+        if (r.perf[0] != -1 || r.perf[1] != -1) {
+            out += "perf " + time_name + ":";
+            for (RecordField &field: fields)
+                if (field.group == 2)
+                    out += " " + string(field.name) + " " + to_string(field.ival);
+            out += "\n";
+        }
+
+        out += "---\n";
+        return;
+    }
+
+    vector <RecordField> fields;
+    get_fields(r, fields);
+
+    if (format == "JSONL")
+        out += "{";
+    for (size_t k = 0; k < fields.size(); k ++) {
+        if (k > 0)
+            out += ",";
+        if (format == "JSONL")
+            out += string("\"") + fields[k].name + "\":";
+
+        if (fields[k].kind == 0)
+            append_number(out, fields[k].ival);
+        else if (fields[k].kind == 1)
+            append_number(out, fields[k].dval);
+        else
+            out += "\"" + fields[k].sval + "\"";  // строки у нас - только имена алгоритмов, экранировать нечего
+    }
+    out += (format == "JSONL") ? "}\n" : "\n";
+}
+
+
+/*
+Бинарный поколоночный формат (все числа в порядке байтов little-endian):
+    8 байт      - сигнатура "KCRES\0\0\0"
+    uint32      - версия формата (= 1)
+    uint32      - количество столбцов C
+    uint64      - количество записей N
+далее C раз описание столбца и сразу его данные:
+    uint32      - длина имени столбца, затем само имя
+    uint8       - вид: 0 - int64, 1 - float64, 2 - строка
+    данные      - для int64/float64: N чисел подряд; для строк: N+1 смещений uint32 и затем все строки подряд.
+Такой файл легко читается, например, через numpy.frombuffer по столбцам.
+*/
+void ResultWriter::write_binary() {
+    /*
+    Данная функция записывает все накопленные записи all_records в бинарном поколоночном формате.
+    */
+
+    vector <vector <RecordField>> rows(all_records.size());
+    for (size_t r = 0; r < all_records.size(); r ++)
+        get_fields(all_records[r], rows[r]);
+
+    vector <RecordField> header;
+    get_fields(ResultRecord(), header);
+
+    const char magic[8] = {'K', 'C', 'R', 'E', 'S', 0, 0, 0};
+    uint32_t version = 1, cols = header.size();
+    uint64_t n = all_records.size();
+    fwrite(magic, 1, 8, file);
+    fwrite(&version, sizeof(version), 1, file);
+    fwrite(&cols, sizeof(cols), 1, file);
+    fwrite(&n, sizeof(n), 1, file);
+
+    for (size_t c = 0; c < header.size(); c ++) {
+        uint32_t len = strlen(header[c].name);
+        uint8_t kind = header[c].kind;
+        fwrite(&len, sizeof(len), 1, file);
+        fwrite(header[c].name, 1, len, file);
+        fwrite(&kind, sizeof(kind), 1, file);
+
+        if (kind == 0) {
+            vector <int64_t> column(n);
+            for (size_t r = 0; r < n; r ++)
+                column[r] = rows[r][c].ival;
+            fwrite(column.data(), sizeof(int64_t), n, file);
+        } else if (kind == 1) {
+            vector <double> column(n);
+            for (size_t r = 0; r < n; r ++)
+                column[r] = rows[r][c].dval;
+            fwrite(column.data(), sizeof(double), n, file);
+        } else {
+            vector <uint32_t> offsets(n + 1, 0);
+            string data;
+            for (size_t r = 0; r < n; r ++) {
+                data += rows[r][c].sval;
+                offsets[r + 1] = data.size();
+            }
+            fwrite(offsets.data(), sizeof(uint32_t), n + 1, file);
+            fwrite(data.data(), 1, data.size(), file);
+        }
+    }
+}
+
+
+void ResultWriter::close() {
+    /*
+    Данная функция дожидается, пока фоновый поток запишет все записи, и закрывает файл.
+    Повторный вызов ничего не делает.
+    */
+
+    if (file == NULL)
+        return;
+
+    {
+        lock_guard <mutex> guard(lock);
+        finished = 1;
+    }
+    has_work.notify_one();
+    worker.join();
+
+    fclose(file);
+    file = NULL;
+}
+
+
+ResultWriter::~ResultWriter() {
+    close();
+}
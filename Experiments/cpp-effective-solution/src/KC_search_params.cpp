@@ -1,10 +1,12 @@
 #include <cmath>  // для функции sqrtf64x квадратного корня
 
 #include "KC_search_params.hpp"
+#include "KC_deadends.hpp"
+#include "KC_simd.hpp"
 #include "rassert.hpp"
 #include "common.hpp"
 
-extern MyHEAP *HEAP;
+extern thread_local MyHEAP *HEAP;
 
 
 
@@ -30,24 +32,52 @@ static inline long double octile_distance(int i1, int j1, int i2, int j2) {
 }
 
 
-static inline int angle_dist(int theta1, int theta2) {
+static uint32_t angle_window(int theta, int A, int theta_amount) {
     /*
-    Функция вычисляет расстояние по углу с учётом его цикличности по модулю ANGLE_NUM.
+    Функция возвращает битовую маску всех углов, отличающихся от theta не больше, чем на A (с учётом цикличности по
+    модулю theta_amount). Маска считается один раз на поиск, после чего проверка угла вершины - это одна операция AND
+    (и она не зависит от того, сколько всего углов).
     */
 
-    rassert(0 <= theta1 && theta1 < ANGLE_NUM && 0 <= theta2 && theta2 < ANGLE_NUM, "Углы должны быть корректными!");
-    int d = abs(theta1 - theta2);
-    return min(d, ANGLE_NUM - d);  // расстояние с цикличностью 
+    uint32_t window = 0;
+    for (int t = theta - A; t <= theta + A; t ++) {
+        int _t = ((t % theta_amount) + theta_amount) % theta_amount;  // делаем угол правильным - от 0 до theta_amount-1
+        window |= (uint32_t(1) << _t);
+    }
+    return window;
+}
+
+
+
+
+void GoalRegion::build(Map *map, Vertex *finish, long double R, uint32_t goal_window) {
+    /*
+    Данная функция растеризует целевую область: клетки карты в радиусе R от finish (условие на расстояние - то же,
+    что раньше проверялось в is_goal) получают маску углов goal_window.
+    */
+
+    int r = max((int) R, -1);  // (дальше, чем на R по одной из координат, целевых клеток точно нет)
+    i0 = max(finish->i - r, 0);
+    j0 = max(finish->j - r, 0);
+    height = max(min(finish->i + r, map->height - 1) - i0 + 1, 0);
+    width = max(min(finish->j + r, map->width - 1) - j0 + 1, 0);
+
+    window.assign(height * width, 0);
+    for (int i = i0; i < i0 + height; i ++)
+        for (int j = j0; j < j0 + width; j ++)
+            if (euclid_dist_2(i, j, finish->i, finish->j) <= R * R)
+                window[(i - i0) * width + (j - j0)] = goal_window;
 }
 
 
 
 
 StateLatticeParams::StateLatticeParams(Vertex *start, Vertex *finish, Map *map, ControlSet *control_set, bool use_fast_closed,
-                                       string mode, long double R, int A) {
+                                       string mode, long double R, int A, DeadEnds *dead_ends) {
     /*
     Конструктор. Инициализирует данный экземпляр.
     Переменная типа bool use_fast_closed указывает, использовать ли быструю версию (через список битов) CLOSED.
+    Если указана маска тупиков dead_ends, то последователи в тупиковых состояниях (достаточно далёких от финиша) не генерируются.
     */    
 
     task_map = map;
@@ -59,10 +89,26 @@ StateLatticeParams::StateLatticeParams(Vertex *start, Vertex *finish, Map *map,
 
     this->control_set = control_set;
 
-    ast = new SearchTree(use_fast_closed);  // создаём дерево поиска
+    this->dead_ends = dead_ends;
+    area = NULL;
+
+    goal_window = angle_window(finish->theta, A, control_set->theta_amount);
+    goal_region.build(map, finish, R, goal_window);
+    goal_at_generation = 0;
+
+    ast = new SearchTree(use_fast_closed, map->height, map->width, control_set->theta_amount);  // создаём дерево поиска
     this->mode = mode;
 
+    if (dead_ends != NULL)
+        collect_dead_goals();
+
     rassert(mode == "PRIM" || mode == "COST", "Не правильный mode в StateLatticeParams!");
+
+    max_degree = 0;
+    for (int theta = 0; theta < control_set->theta_amount; theta ++)
+        max_degree = max(max_degree, (int) max(control_set->get_prims_by_heading(theta).size(),
+                                               control_set->get_prims_by_goal_heading(theta).size()));
+    rassert(map->height < (1 << 22) && map->width < (1 << 22), "Слишком большая карта для упаковки вершин в StateKey!");
 }
 
 
@@ -81,13 +127,20 @@ ptrVertex StateLatticeParams::get_start_vertex() {
 bool StateLatticeParams::is_goal(ptrVertex v) {
     /*
     Данная функция должна проверить, является ли вершина v целевой, нужно ли на ней прекратить поиск.
-    Поиск мы прекращаем на вершинах, чьи координаты находятся в радиусе R от финиша, а номер дискретного угла отличается <=A.
+    Поиск мы прекращаем на вершинах, чьи координаты находятся в радиусе R от финиша, а номер дискретного угла отличается <=A
+    (такие клетки и углы заранее отмечены в goal_region).
     */
 
-    long double dist_2 = euclid_dist_2(v->i, v->j, finish->i, finish->j);  // расстояние (его квадрат) по координатам
-    int a_dist = angle_dist(v->theta, finish->theta);  // расстояние по углу
+    return (goal_region.at(v->i, v->j) >> v->theta) & 1;
+}
+
 
-    return (dist_2 <= R * R) && (a_dist <= A);    
+bool StateLatticeParams::is_goal_key(StateKey key) {
+    /*
+    То же для последователя, заданного ключом key (вершина графа для него ещё не создана).
+    */
+
+    return (goal_region.at(state_i(key), state_j(key)) >> state_code(key)) & 1;
 }
 
 
@@ -99,9 +152,15 @@ bool StateLatticeParams::check_prim(int i, int j, Primitive* prim) {
     параллельный перенос на (i,j).
     */
 
-    for (size_t k = 0; k < prim->collision_in_i.size(); k ++) {  // проверяем, что каждая клетка коллизионного следа свободна от препятствий
-        int i_coll = prim->collision_in_i[k];
-        int j_coll = prim->collision_in_j[k];
+    STATS(ast->stats.check_prim_calls += 1);
+
+    if (task_map->in_bounds(i, j) && task_map->get_clearance(i, j) > prim->reach)  // если ближайшее препятствие дальше, чем отходит
+        return 1;                                                               // след примитива, то проверять каждую клетку не нужно
+
+    for (int k = 0; k < prim->collision_size; k ++) {  // проверяем, что каждая клетка коллизионного следа свободна от препятствий
+        int i_coll = prim->coll_sign_i * prim->collision_in_i[k];
+        int j_coll = prim->coll_sign_j * prim->collision_in_j[k];
+        STATS(ast->stats.collision_cells += 1);
         if (!(task_map->in_bounds(i_coll+i, j_coll+j) && task_map->traversable(i_coll+i, j_coll+j)))  // не забываем делать параллельный перенос клетки на (i,j)
             return 0;
     }
@@ -109,42 +168,203 @@ bool StateLatticeParams::check_prim(int i, int j, Primitive* prim) {
 }
 
 
-void StateLatticeParams::get_successors(ptrVertex v, vector <pair <ptrVertex, long double>> &list) {
+void StateLatticeParams::collect_dead_goals() {
+    /*
+    Данная функция находит тупиковые состояния, из которых можно доехать до цели (см. KC_deadends.hpp): сначала
+    берутся сами целевые тупиковые состояния, а затем обратным обходом - тупики, из которых в них есть допустимый
+    примитив. Пути из тупика проходят только по тупикам, поэтому других тупиков, из которых достижима цель, нет.
+    */
+
+    dead_goal_reaching.clear();
+    vector <Vertex> stack;
+
+    int r = (int) R;
+    for (int i = finish->i - r; i <= finish->i + r; i ++)
+        for (int j = finish->j - r; j <= finish->j + r; j ++) {
+            if (!task_map->in_bounds(i, j) || !task_map->traversable(i, j))
+                continue;
+            for (int theta = 0; theta < control_set->theta_amount; theta ++) {  // условие на целевое состояние - как в is_goal
+                bool goal = (goal_region.at(i, j) >> theta) & 1;
+                if (goal && dead_ends->is_dead(i, j, theta)) {
+                    dead_goal_reaching.insert(dead_ends->state(i, j, theta));
+                    stack.push_back(Vertex(i, j, theta));
+                }
+            }
+        }
+
+    while (!stack.empty()) {
+        Vertex u = stack.back();
+        stack.pop_back();
+        for (Primitive *prim: control_set->get_prims_by_goal_heading(u.theta)) {  // предшественники u
+            int vi = u.i - prim->goal.i;
+            int vj = u.j - prim->goal.j;
+            if (!task_map->in_bounds(vi, vj) || !task_map->traversable(vi, vj) || !dead_ends->is_dead(vi, vj, prim->start_theta))
+                continue;
+            size_t v = dead_ends->state(vi, vj, prim->start_theta);
+            if (dead_goal_reaching.count(v) == 0 && check_prim(vi, vj, prim)) {
+                dead_goal_reaching.insert(v);
+                stack.push_back(Vertex(vi, vj, prim->start_theta));
+            }
+        }
+    }
+}
+
+
+bool StateLatticeParams::set_finish(Vertex *finish) {
+    /*
+    Данная функция меняет цель поиска на finish, не трогая дерево поиска (чтобы продолжить уже построенное дерево
+    до новой цели - см. AstarContinue). Возвращает 0, если продолжать это дерево нельзя: при его построении были
+    отброшены тупики, из которых можно доехать до новой цели.
+    */
+
+    this->finish = finish;
+    goal_window = angle_window(finish->theta, A, control_set->theta_amount);
+    goal_region.build(task_map, finish, R, goal_window);
+    if (dead_ends == NULL)
+        return 1;
+
+    unordered_set <size_t> kept = dead_goal_reaching;  // тупики, которые дерево до сих пор не отбрасывало
+    collect_dead_goals();
+    bool ok = 1;
+    for (size_t v: dead_goal_reaching)
+        if (kept.count(v) == 0)
+            ok = 0;
+    dead_goal_reaching.insert(kept.begin(), kept.end());  // дальше не отбрасываем тупики ни для какой из целей
+    return ok;
+}
+
+
+long double StateLatticeParams::edge_cost(Primitive *prim) {
+    /*
+    Данная функция возвращает стоимость ребра state lattice, которое задаётся примитивом prim.
+    */
+
+    if (mode == "PRIM")  // в случае PRIM стоимость = длина примитива
+        return prim->length;
+    else if (mode == "COST")  // в COST стоимость = длина коллизионного следа
+        return prim->collision_cost;
+    else  // других вариантов быть не должно!
+        return -1;
+}
+
+
+void StateLatticeParams::get_successors(ptrVertex v, Successors &list) {
     /*
-    Данная функция генерирует последователей вершины v, а затем складывает пары из них и стоимостей
-    перехода в них в список list.
+    Данная функция генерирует последователей вершины v, а затем складывает их (упакованными в StateKey) вместе со
+    стоимостями перехода в них в буфер list (сам буфер не очищает).
     */
 
     for (Primitive *prim: control_set->get_prims_by_heading(v->theta)) {  // перебираем примитивы, выходящие из дискретного состояния v
                                                                           // (ими будут копии (сдвинутые параллельным переносом на v->i, v->j) тех примитивов control_set, которые начинаются под дискретным углом этого состояния)
         if (check_prim(v->i, v->j, prim) == 1) {  // если примитив prim не задевает препятствия
-            ptrVertex u = HEAP->new_Vertex(v->i + prim->goal->i,
-                                           v->j + prim->goal->j,
-                                           prim->goal->theta);  // этот примитив ведёт в такую вершину (целевое состояние prim->goal, сдвинутое параллельным переносом)
-            long double cost;  // стоимость перехода в эту вершину
-            if (mode == "PRIM")  // в случае PRIM стоимость = длина примитива
-                cost = prim->length;
-            else if (mode == "COST")  // в COST стоимость = длина коллизионного следа
-                cost = prim->collision_cost;
-            else  // других вариантов быть не должно!
-                cost = -1;
-            list.push_back({u, cost});  // складываем в список вершину и стоимость перехода в неё
+            if (area != NULL && area[(size_t) (v->i + prim->goal.i) * task_map->width + v->j + prim->goal.j] == 0)
+                continue;  // примитив заканчивается вне разрешённой области
+            if (dead_ends != NULL && dead_ends->is_dead(v->i + prim->goal.i, v->j + prim->goal.j, prim->goal.theta) &&
+                dead_goal_reaching.count(dead_ends->state(v->i + prim->goal.i, v->j + prim->goal.j, prim->goal.theta)) == 0) {
+                STATS(ast->stats.pruned_dead_ends += 1);
+                continue;  // примитив ведёт в тупик, из которого не доехать до цели
+            }
+            // этот примитив ведёт в такую вершину (целевое состояние prim->goal, сдвинутое параллельным переносом) -
+            // складываем в список её ключ и стоимость перехода в неё:
+            list.push(pack_state(v->i + prim->goal.i, v->j + prim->goal.j, prim->goal.theta), prim->goal.theta, edge_cost(prim));
         }
     }
 }
 
 
+void StateLatticeParams::get_predecessors(ptrVertex v, Successors &list) {
+    /*
+    Данная функция генерирует предшественников вершины v (те состояния, у которых v среди последователей) вместе
+    со стоимостями перехода из них в v - это нужно поиску, который перестраивает путь после изменения карты (см.
+    KC_replanning.hpp). Предшественники ровно соответствуют get_successors (в том числе и отбрасыванию тупиков).
+    */
+
+    if (dead_ends != NULL && dead_ends->is_dead(v->i, v->j, v->theta) &&
+        dead_goal_reaching.count(dead_ends->state(v->i, v->j, v->theta)) == 0)
+        return;  // в такой тупик последователей не генерируем -> и предшественников у него нет
+    if (area != NULL && area[(size_t) v->i * task_map->width + v->j] == 0)
+        return;  // и вне разрешённой области тоже
+
+    for (Primitive *prim: control_set->get_prims_by_goal_heading(v->theta)) {  // примитивы, которые заканчиваются под углом v
+        int i = v->i - prim->goal.i;  // откуда должен выходить примитив, чтобы закончиться в v
+        int j = v->j - prim->goal.j;
+        if (task_map->in_bounds(i, j) && check_prim(i, j, prim) == 1)
+            list.push(pack_state(i, j, prim->start_theta), prim->start_theta, edge_cost(prim));
+    }
+}
+
+
+void StateLatticeParams::get_affected(int i, int j, vector <pair <Vertex, Vertex>> &edges) {
+    /*
+    Данная функция складывает в edges все рёбра state lattice (пары "откуда - куда"), коллизионный след которых проходит
+    через клетку (i, j): только их допустимость меняется, когда эта клетка становится занятой или свободной. Ребро -
+    это примитив, сдвинутый так, чтобы k-ая клетка его следа попала в (i, j), поэтому таких рёбер столько, сколько
+    всего клеток в следах всех примитивов.
+    */
+
+    for (int theta = 0; theta < control_set->theta_amount; theta ++)
+        for (Primitive *prim: control_set->get_prims_by_heading(theta))
+            for (int k = 0; k < prim->collision_size; k ++) {
+                int from_i = i - prim->coll_sign_i * prim->collision_in_i[k];  // сдвиг, при котором k-ая клетка следа попадает в (i, j)
+                int from_j = j - prim->coll_sign_j * prim->collision_in_j[k];
+                if (task_map->in_bounds(from_i, from_j))
+                    edges.push_back({Vertex(from_i, from_j, theta),
+                                     Vertex(from_i + prim->goal.i, from_j + prim->goal.j, prim->goal.theta)});
+            }
+}
+
+
+ptrVertex StateLatticeParams::new_vertex(StateKey key, int info) {
+    /*
+    Данная функция создаёт в куче HEAP вершину (дискретное состояние) с ключом key (info - это её угол).
+    */
+
+    return HEAP->new_Vertex(state_i(key), state_j(key), info);
+}
+
+
 long double StateLatticeParams::heuristic(ptrVertex v) {
     /*
     Данная вершина оценивает оставшееся расстояние до целевой вершины от вершины v.
     */
 
+#ifdef SIMD_HEURISTIC
+    long double h;  // (та же формула в double, что и у пакета последователей - эвристика должна быть одной и той же)
+    heuristic_batch(&v->i, &v->j, 1, &h);
+    return h;
+#else
     if (mode == "PRIM")
         return sqrtf64x(euclid_dist_2(v->i, v->j, finish->i, finish->j));  // не забываем брать корень в евклидовом расстоянии
     else if (mode == "COST")
         return octile_distance(v->i, v->j, finish->i, finish->j);
     else
         return -1;
+#endif
+}
+
+
+void StateLatticeParams::heuristic_batch(const int *i, const int *j, int n, long double *h) {
+    /*
+    Данная функция для всех k < n записывает в h[k] эвристику вершины с координатами (i[k], j[k]) (угол на эвристику
+    не влияет). С SIMD_HEURISTIC считается векторными ядрами в double (см. KC_simd.hpp), иначе - по той же формуле, что
+    heuristic, но поиск без SIMD_HEURISTIC пакетами не пользуется (с -ffast-math пакетный цикл округляется иначе).
+    */
+
+    bool prim = (mode == "PRIM");  // (режим сравниваем один раз на весь пакет)
+#ifdef SIMD_HEURISTIC
+    static thread_local vector <double> out;
+    if ((int) out.size() < n)
+        out.resize(n);
+    if (prim)
+        euclid_batch(i, j, n, finish->i, finish->j, out.data());
+    else
+        octile_batch(i, j, n, finish->i, finish->j, out.data());
+    for (int k = 0; k < n; k ++)
+        h[k] = out[k];
+#else
+    for (int k = 0; k < n; k ++)
+        h[k] = prim ? sqrtf64x(euclid_dist_2(i[k], j[k], finish->i, finish->j)) : octile_distance(i[k], j[k], finish->i, finish->j);
+#endif
 }
 
 
@@ -166,7 +386,20 @@ TypesGraphParams::TypesGraphParams(Vertex *start, Vertex *finish, Map *map, Type
 
     this->type_info = type_info;
 
-    ast = new SearchTree(use_fast_closed);  // создаём дерево поиска
+    // отмечаем все углы, которые подходят (с точки зрения меры A) для того, чтобы типовая ячейка,
+    // в которой оканчивается примитив под таким углом, считалась целевой:
+    goal_window = angle_window(finish->theta, A, type_info->theta_amount);
+    goal_region.build(map, finish, R, goal_window);
+    goal_at_generation = 0;
+
+    ast = new SearchTree(use_fast_closed, map->height, map->width, type_info->info_amount);  // создаём дерево поиска
+
+    max_degree = 0;
+    for (int type = 0; type < type_info->types_amount; type ++)
+        max_degree = max(max_degree, max(type_info->succ_begin[type + 1] - type_info->succ_begin[type],
+                                         type_info->pred_begin[type + 1] - type_info->pred_begin[type]));
+    rassert(map->height < (1 << 22) && map->width < (1 << 22) && type_info->types_amount < (1 << 20),
+            "Слишком большая карта или слишком много типов для упаковки вершин в StateKey!");
 }
 
 
@@ -189,68 +422,156 @@ ptrVertex TypesGraphParams::get_start_vertex() {
 }
 
 
+bool TypesGraphParams::set_finish(Vertex *finish) {
+    /*
+    Данная функция меняет цель поиска на finish, не трогая дерево поиска (см. StateLatticeParams::set_finish).
+    На графе типов последователи не зависят от цели -> дерево можно продолжать всегда.
+    */
+
+    this->finish = finish;
+    goal_window = angle_window(finish->theta, A, type_info->theta_amount);
+    goal_region.build(task_map, finish, R, goal_window);
+    return 1;
+}
+
+
 bool TypesGraphParams::is_goal(ptrVertex v) {
     /*
     Данная функция должна проверить, является ли вершина (= типовая ячейка) v целевой, нужно ли на ней прекратить поиск.
     Этот код будет делать аналогичное, что делал код в Питоне.
     */
 
-    size_t type = v->type;
-    int ft = type_info->goal_theta_by_type[type];
-    if (ft == -1)  // если ячейка не целевая, сразу выходим
-        return 0;
-    
-    long double dist_2 = euclid_dist_2(v->i, v->j, finish->i, finish->j);  // расстояние по координатам
-    if (dist_2 > R * R)
-        return 0;  // если расстояние большое, то ячейка точно не целевая
-
-    if (ft >= 0) {  // если есть финальный угол только один, то проверяем его
-        if (angle_dist(ft, finish->theta) <= A)
-            return 1;
-        else
-            return 0;
-    }
-    
-    for (int ft1 = finish->theta - A; ft1 <= finish->theta + A; ft1 ++) {  // перебираем все углы ft1, которые подходят (с точки зрения меры A) для того, чтобы типовая ячейка,
-                                                                        // в которой оканчивается примитив под таким углом, считалась целевой
-        int _ft = ((ft1 % ANGLE_NUM) + ANGLE_NUM) % ANGLE_NUM;  // делаем угол правильным - от 0 до ANGLE_NUM-1
-        if (type_info->is_goal_by_theta_type[_ft][type] == 1)  // если в type и правда кончается такой примитив,
-            return 1;  // ячейка целевая
-    }
-
-    return 0;    
+    // ячейка целевая, если она не дальше R от финиша и в ней кончается примитив под подходящим углом (goal_region
+    // хранит для таких клеток goal_window, а для остальных 0):
+    return (goal_region.at(v->i, v->j) & type_info->goal_mask_by_type[v->type]) != 0;
 }
 
 
-void TypesGraphParams::get_successors(ptrVertex v, vector <pair <ptrVertex, long double>> &list) {
+bool TypesGraphParams::is_goal_key(StateKey key) {
     /*
-    Данная функция генерирует последователей вершины v и складывает их в список list. В паре с вершинами складываются
-    стоимости перехода в них.
+    То же для последователя, заданного ключом key.
     */
 
-    for (auto triple: type_info->successors[v->type]) {  // получаем соседей типа v->type
-        int di = get<0>(triple);
-        int dj = get<1>(triple);
-        int t = get<2>(triple);
+    return (goal_region.at(state_i(key), state_j(key)) & type_info->goal_mask_by_type[state_code(key)]) != 0;
+}
 
-        if (task_map->in_bounds(v->i+di, v->j+dj) && task_map->traversable(v->i+di, v->j+dj))  {  // если сосед не занят препятствием, то добавляем в массив
-            ptrVertex u = HEAP->new_Vertex(v->i+di, v->j+dj, t, type_info->add_info_by_type[t]);
-            long double cost;
-            if (di == 0 || dj == 0)  // если переход в соседа по стороне (стороне клетки коллизионного следа), то стоимость 1
-                cost = 1;
-            else  // иначе - переход по углу, стоимость = корень из 2
-                cost = 1.41421356237L;
 
-            list.push_back({u, cost});
+void TypesGraphParams::get_successors(ptrVertex v, Successors &list) {
+    /*
+    Данная функция генерирует последователей вершины v и складывает их (ключ и информация для склеивания) в буфер list
+    вместе со стоимостями перехода в них.
+    */
+
+    const TypeSuccessor *begin = type_info->succ + type_info->succ_begin[v->type];  // соседи типа v->type
+    const TypeSuccessor *end = type_info->succ + type_info->succ_begin[v->type + 1];
+    for (const TypeSuccessor *s = begin; s != end; s ++) {
+        STATS(ast->stats.collision_cells += 1);
+        if (task_map->in_bounds(v->i+s->di, v->j+s->dj) && task_map->traversable(v->i+s->di, v->j+s->dj))  {  // если сосед не занят препятствием, то добавляем в массив
+            list.push(pack_state(v->i+s->di, v->j+s->dj, s->type), s->info, s->cost);  // стоимость перехода уже посчитана при загрузке типов (1 по стороне, корень из 2 по углу)
         }
     }
 }
 
 
+void TypesGraphParams::get_predecessors(ptrVertex v, Successors &list) {
+    /*
+    Данная функция генерирует предшественников типовой ячейки v вместе со стоимостями перехода из них в v (см.
+    StateLatticeParams::get_predecessors). Переход в ячейку допустим, только если её клетка свободна.
+    */
+
+    if (!task_map->in_bounds(v->i, v->j) || !task_map->traversable(v->i, v->j))
+        return;
+
+    const TypeSuccessor *begin = type_info->pred + type_info->pred_begin[v->type];
+    const TypeSuccessor *end = type_info->pred + type_info->pred_begin[v->type + 1];
+    for (const TypeSuccessor *r = begin; r != end; r ++)
+        if (task_map->in_bounds(v->i+r->di, v->j+r->dj))
+            list.push(pack_state(v->i+r->di, v->j+r->dj, r->type), r->info, r->cost);
+}
+
+
+void TypesGraphParams::get_affected(int i, int j, vector <pair <Vertex, Vertex>> &edges) {
+    /*
+    Данная функция складывает в edges все рёбра графа типов, допустимость которых зависит от клетки (i, j) (см.
+    StateLatticeParams::get_affected): на графе типов это все рёбра, ведущие в ячейки клетки (i, j).
+    */
+
+    for (int type = 0; type < type_info->types_amount; type ++)
+        for (int k = type_info->pred_begin[type]; k < type_info->pred_begin[type + 1]; k ++) {
+            const TypeSuccessor &r = type_info->pred[k];
+            if (task_map->in_bounds(i+r.di, j+r.dj))
+                edges.push_back({Vertex(i+r.di, j+r.dj, r.type, r.info), Vertex(i, j, type, type_info->add_info_by_type[type])});
+        }
+}
+
+
+ptrVertex TypesGraphParams::new_vertex(StateKey key, int info) {
+    /*
+    Данная функция создаёт в куче HEAP типовую ячейку с ключом key и информацией для склеивания info.
+    */
+
+    return HEAP->new_Vertex(state_i(key), state_j(key), state_code(key), info);
+}
+
+
 long double TypesGraphParams::heuristic(ptrVertex v) {
     /*
     Данная вершина оценивает оставшееся расстояние до целевой вершины от вершины v.
     */
 
+#ifdef SIMD_HEURISTIC
+    long double h;
+    heuristic_batch(&v->i, &v->j, 1, &h);
+    return h;
+#else
     return octile_distance(v->i, v->j, finish->i, finish->j);
+#endif
+}
+
+
+void TypesGraphParams::heuristic_batch(const int *i, const int *j, int n, long double *h) {
+    /*
+    Данная функция считает эвристику сразу для n ячеек (аналогично StateLatticeParams::heuristic_batch).
+    */
+
+#ifdef SIMD_HEURISTIC
+    static thread_local vector <double> out;
+    if ((int) out.size() < n)
+        out.resize(n);
+    octile_batch(i, j, n, finish->i, finish->j, out.data());
+    for (int k = 0; k < n; k ++)
+        h[k] = out[k];
+#else
+    for (int k = 0; k < n; k ++)
+        h[k] = octile_distance(i[k], j[k], finish->i, finish->j);
+#endif
+}
+
+
+
+
+bool may_reach(Map *map, Vertex *start, Vertex *finish, long double R) {
+    /*
+    Данная функция за O(R^2) (то есть фактически за O(1)) проверяет, может ли вообще существовать путь из start в
+    какую-нибудь целевую вершину (и на state lattice, и на графе типов). Если функция вернула 0, то пути точно нет
+    и запускать A* не нужно (иначе он раскроет всю доступную из старта часть графа, прежде чем это поймёт).
+
+    Целевыми считаются вершины в клетках на расстоянии не больше R от finish, а любой путь проходит только по
+    соседним свободным клеткам (см. Map::calc_components) -> путь возможен, только если старт сам достаточно
+    близок к финишу или хотя бы одна свободная клетка в радиусе R от финиша лежит в одной компоненте со стартом.
+    */
+
+    if (euclid_dist_2(start->i, start->j, finish->i, finish->j) <= R * R)
+        return 1;  // старт может и сам оказаться целевым
+    if (!map->in_bounds(start->i, start->j) || !map->traversable(start->i, start->j))
+        return 1;  // на графе типов из занятой стартовой клетки можно шагнуть в любую соседнюю свободную - не отвергаем
+
+    int start_component = map->get_component(start->i, start->j);
+    int r = (int) R;
+    for (int i = finish->i - r; i <= finish->i + r; i ++)
+        for (int j = finish->j - r; j <= finish->j + r; j ++)
+            if (map->in_bounds(i, j) && euclid_dist_2(i, j, finish->i, finish->j) <= R * R &&
+                map->get_component(i, j) == start_component)
+                return 1;
+    return 0;
 }
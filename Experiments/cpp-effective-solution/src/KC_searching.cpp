@@ -1,12 +1,14 @@
 #include <fstream>
 #include <sstream>
+#include <cstring>
+#include <stdexcept>
 
 #include "KC_searching.hpp"
 #include "KC_heap.hpp"
 #include "common.hpp"
 #include "rassert.hpp"
 
-extern MyHEAP* HEAP;
+extern thread_local MyHEAP* HEAP;
 
 
 
@@ -17,6 +19,12 @@ Map::Map() {
     */
 
     width = height = 0;
+    row_words = 0;
+    cells = NULL;
+    clearance = NULL;
+    component = NULL;
+    components_amount = 0;
+    components_valid = 1;
 }
 
 
@@ -28,50 +36,287 @@ void Map::read_file_to_cells(string _file, bool obs) {
     идут ещё 4 строки с доп информацией - так выглядят карты коллекции MovingAI.
 
     Также есть параметр obs - если он True, то учитываем препятствия, иначе считаем карту пустой.
+
+    Если рядом с картой уже лежит её актуальный кэш (_file + ".kcache"), то карта берётся из него; иначе карта
+    разбирается и кэш сохраняется (если сохранить не удалось, например, нет прав на запись, то просто работаем без него).
     */
 
-    ifstream file(_file);
-    rassert(file.is_open() == 1, "Файл с картой не открылся! Возможно, несуществующий файл");
-    
-    string line;  // строка (= ряд клеток рабочего пространства)
-    string temp;  // временная строка для считывания информации
-
-    while (getline(file, line)) {  // считываем по строке line из файла с картой
-        if (line.find("type") == 0) {  // первые 4 строки (первая из них со слова type начинается) пропускаем - а далее уже идёт сама карта
-            getline(file, line);
-            getline(file, line);
-            getline(file, line);
-            continue;
+    if (obs && load_cache(_file + ".kcache"))
+        return;
+
+    parse_text(_file, obs);
+    calc_clearance();
+    calc_components();
+
+    if (obs) {
+        try {
+            save_cache(_file);
+        } catch (exception &e) {
+            (void) e;  // без кэша всё работает так же, просто медленнее загружается
+        }
+    }
+}
+
+
+static bool is_map_symbol(char c) {
+    /*
+    Данная функция проверяет, обозначает ли символ c клетку карты (остальные символы в рядах игнорируются).
+    */
+
+    return c == '.' || c == '#' || c == '@' || c == 'T';
+}
+
+
+void Map::parse_text(string _file, bool obs) {
+    /*
+    Данная функция разбирает текстовый файл карты _file. Файл читается целиком одним блоком, а затем
+    ряды разбираются прямо в битовую матрицу (без промежуточных векторов для каждого ряда).
+    */
+
+    FILE *file = fopen(_file.c_str(), "rb");
+    if (file == NULL)
+        throw runtime_error("Файл с картой не открылся! Возможно, несуществующий файл: " + _file);
+    string text;
+    char buf[1 << 16];
+    size_t got;
+    while ((got = fread(buf, 1, sizeof(buf), file)) > 0)
+        text.append(buf, got);
+    fclose(file);
+
+    vector <pair <size_t, size_t>> rows;  // начало и конец каждого ряда клеток в text
+    size_t pos = 0;
+    int skip = 0;  // сколько ещё строк заголовка пропустить
+    while (pos < text.size()) {
+        size_t end = text.find('\n', pos);
+        if (end == string::npos)
+            end = text.size();
+
+        if (text.compare(pos, 4, "type") == 0)  // первые 4 строки (первая из них со слова type начинается) пропускаем - а далее уже идёт сама карта
+            skip = 4;
+        if (skip > 0)
+            skip -= 1;
+        else if (end > pos && !(end == pos + 1 && text[pos] == '\r'))  // пустые строки пропускаем
+            rows.push_back({pos, end});
+        pos = end + 1;
+    }
+
+    height = rows.size();
+    width = 0;
+    if (height > 0)
+        for (size_t k = rows[0].first; k < rows[0].second; k ++)
+            width += is_map_symbol(text[k]);
+    row_words = (width + 63) / 64;
+
+    own_cells.assign((size_t) height * row_words, 0);
+    for (int i = 0; i < height; i ++) {
+        uint64_t *row = own_cells.data() + (size_t) i * row_words;
+        int j = 0;
+        for (size_t k = rows[i].first; k < rows[i].second; k ++) {
+            char c = text[k];
+            if (!is_map_symbol(c))
+                continue;
+            if (j >= width)
+                throw runtime_error("Все ряды клеток на карте должны быть одинаковой длины (карта прямоугольная)!");
+            if (c != '.' && obs)
+                row[j >> 6] |= uint64_t(1) << (j & 63);  // занятая клетка
+            j += 1;
+        }
+        if (j != width)
+            throw runtime_error("Все ряды клеток на карте должны быть одинаковой длины (карта прямоугольная)!");
+    }
+
+    cells = own_cells.data();
+}
+
+
+void Map::calc_clearance() {
+    /*
+    Данная функция для каждой клетки считает clearance - расстояние max(|di|, |dj|) до ближайшей занятой клетки или
+    клетки за пределами карты (у занятой клетки оно 0, у свободной клетки на краю карты - 1).
+    Считается двумя проходами (сверху вниз и снизу вверх), на каждом из которых значение клетки уточняется через
+    уже посчитанных соседей: для такой метрики двух проходов достаточно, чтобы получить точные расстояния.
+    */
+
+    own_clearance.assign((size_t) height * width, 0);
+    uint16_t *d = own_clearance.data();
+
+    auto get = [&](int i, int j) -> int {  // расстояние в соседней клетке (за пределами карты - как у препятствия)
+        if (!in_bounds(i, j))
+            return 0;
+        return d[(size_t) i * width + j];
+    };
+
+    for (int i = 0; i < height; i ++)
+        for (int j = 0; j < width; j ++) {
+            if (!traversable(i, j))
+                continue;  // у препятствий 0
+            int best = min(min(get(i-1, j-1), get(i-1, j)), min(get(i-1, j+1), get(i, j-1))) + 1;
+            d[(size_t) i * width + j] = min(best, 65535);
+        }
+
+    for (int i = height - 1; i >= 0; i --)
+        for (int j = width - 1; j >= 0; j --) {
+            if (!traversable(i, j))
+                continue;
+            int best = min(min(get(i+1, j+1), get(i+1, j)), min(get(i+1, j-1), get(i, j+1))) + 1;
+            best = min(best, (int) d[(size_t) i * width + j]);
+            d[(size_t) i * width + j] = best;
         }
-        if (line.size() == 0)  // пустые строки пропускаем
-            continue;
 
-        vector <bool> cells_row;  // ряд клеток в виде булева вектора (в нём элемент = 1, если клетка занята и 0 иначе)
-
-        for (char c: line) {  // рассматриваем по символу в строке
-            if (c == '.')
-                cells_row.push_back(0);  // свободная клетка
-            else if (c == '#' || c == '@' || c == 'T') {
-                if (obs)
-                    cells_row.push_back(1);  // занятая клетка
-                else
-                    cells_row.push_back(0);
-            } else
+    clearance = own_clearance.data();
+}
+
+
+
+
+void Map::calc_components() {
+    /*
+    Данная функция разбивает свободные клетки на компоненты связности (две свободные клетки, соседние по стороне
+    или по углу, лежат в одной компоненте) с помощью системы непересекающихся множеств (union-find), а затем
+    нумерует компоненты подряд от 0 до components_amount-1.
+    Так как любая траектория (и коллизионный след примитива, и путь по графу типов) проходит по цепочке таких
+    соседних свободных клеток, то из одной компоненты в другую попасть нельзя.
+    */
+
+    vector <int> parent((size_t) height * width);  // родитель клетки в дереве её множества
+    for (size_t k = 0; k < parent.size(); k ++)
+        parent[k] = k;
+
+    auto find = [&](int x) {  // корень множества клетки x (заодно сокращаем путь до корня вдвое)
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    };
+    auto unite = [&](int x, int y) {
+        x = find(x);
+        y = find(y);
+        if (x != y)
+            parent[max(x, y)] = min(x, y);  // корнем всегда делаем клетку с меньшим номером
+    };
+
+    for (int i = 0; i < height; i ++)
+        for (int j = 0; j < width; j ++) {
+            if (!traversable(i, j))
                 continue;
+            int x = i * width + j;
+            // соединяем с уже просмотренными соседями: слева, слева сверху, сверху и справа сверху
+            if (in_bounds(i, j-1) && traversable(i, j-1))
+                unite(x, x - 1);
+            for (int dj = -1; dj <= 1; dj ++)
+                if (in_bounds(i-1, j+dj) && traversable(i-1, j+dj))
+                    unite(x, x - width + dj);
         }
 
-        if (cells.size() > 0)
-            rassert(cells[0].size() == cells_row.size(), "Все ряды клеток на карте должны быть одинаковой длины (карта прямоугольная)!");
+    own_component.assign((size_t) height * width, -1);
+    components_amount = 0;
+    for (int i = 0; i < height; i ++)
+        for (int j = 0; j < width; j ++) {
+            if (!traversable(i, j))
+                continue;
+            int x = i * width + j;
+            int root = find(x);
+            if (root == x)  // корни встречаются раньше остальных клеток своего множества (у корня наименьший номер)
+                own_component[x] = components_amount ++;
+            else
+                own_component[x] = own_component[root];
+        }
+
+    component = own_component.data();
+    components_valid = 1;
+}
+
+
+
+
+#define MAP_CACHE_MAGIC "KCMAP\0\0"  // сигнатура кэша карты (дополнена нулями до 8 байт)
+#define MAP_CACHE_VERSION 2
 
-        cells.push_back(cells_row);  // добавляем очередной ряд клеток
+
+struct MapCacheHeader {
+    /*
+    Заголовок кэша карты. Кэш считается актуальным, если размер и время изменения файла карты совпадают с
+    записанными в заголовке, а контрольная сумма всех данных после заголовка совпадает с checksum.
+    */
+
+    char magic[8];
+    uint32_t version;
+    uint32_t height, width, row_words;
+    uint32_t components_amount;
+    uint64_t source_size;  // размер исходного файла карты
+    int64_t source_mtime;  // время его последнего изменения (в наносекундах)
+    uint64_t checksum;  // контрольная сумма данных после заголовка
+
+    uint64_t cells, clearance, component;  // смещения массивов
+};
+
+
+bool Map::load_cache(string cache_file) {
+    /*
+    Данная функция пытается загрузить карту из кэша cache_file. Возвращает 0, если кэша нет, он устарел или повреждён.
+    */
+
+    string source = cache_file.substr(0, cache_file.size() - 7);  // убираем ".kcache"
+    uint64_t size;
+    int64_t mtime;
+    if (!file_stamp(source, size, mtime) || !file_starts_with(cache_file, MAP_CACHE_MAGIC))
+        return 0;
+    if (!mapped.open(cache_file) || mapped.size < sizeof(MapCacheHeader)) {
+        mapped.close();
+        return 0;
+    }
+
+    const MapCacheHeader *h = mapped.at <MapCacheHeader> (0);
+    size_t cells_bytes = (size_t) h->height * h->row_words * sizeof(uint64_t);
+    size_t clearance_bytes = (size_t) h->height * h->width * sizeof(uint16_t);
+    size_t component_bytes = (size_t) h->height * h->width * sizeof(int);
+    bool ok = h->version == MAP_CACHE_VERSION && h->source_size == size && h->source_mtime == mtime &&
+              h->cells + cells_bytes <= mapped.size && h->clearance + clearance_bytes <= mapped.size &&
+              h->component + component_bytes <= mapped.size &&
+              h->cells % BINARY_ALIGN == 0 && h->clearance % BINARY_ALIGN == 0 && h->component % BINARY_ALIGN == 0 &&
+              checksum64(mapped.data + sizeof(MapCacheHeader), mapped.size - sizeof(MapCacheHeader)) == h->checksum;
+    if (!ok) {
+        mapped.close();
+        return 0;
     }
-    file.close();
 
-    height = cells.size();  // вычисляем размеры карты
-    width = cells[0].size();
+    height = h->height;
+    width = h->width;
+    row_words = h->row_words;
+    cells = mapped.at <uint64_t> (h->cells);
+    clearance = mapped.at <uint16_t> (h->clearance);
+    component = mapped.at <int> (h->component);
+    components_amount = h->components_amount;
+    own_cells.clear();
+    own_clearance.clear();
+    own_component.clear();
+    return 1;
+}
+
+
+void Map::save_cache(string file) {
+    /*
+    Данная функция сохраняет уже прочитанную из файла file карту в кэш (file + ".kcache").
+    */
+
+    MapCacheHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, MAP_CACHE_MAGIC, 8);
+    h.version = MAP_CACHE_VERSION;
+    h.height = height;
+    h.width = width;
+    h.row_words = row_words;
+    h.components_amount = components_amount;
+    if (!file_stamp(file, h.source_size, h.source_mtime))
+        return;
 
-    rassert(0 <= height && height < MAX_MAP_HEIGHT && 0 <= width && width < MAX_MAP_WIDTH,
-            "Слишком большая карта! Измените ограничения MAX_MAP_HEIGHT и WIDTH!");
+    BinaryWriter out(sizeof(h));
+    h.cells = out.add_array(cells, (size_t) height * row_words);
+    h.clearance = out.add_array(clearance, (size_t) height * width);
+    h.component = out.add_array(component, (size_t) height * width);
+    h.checksum = checksum64(out.bytes.data() + sizeof(h), out.bytes.size() - sizeof(h));
+    out.save(file + ".kcache", &h, sizeof(h));
 }
 
 
@@ -89,7 +334,92 @@ bool Map::traversable(int i, int j) {
     Данная функция проверяет, является ли клетка (i,j) свободной.
     */
 
-    return (cells[i][j] == 0);  // у свободной клетки соответствующий элемент в матрице равен 0
+    return ((cells[(size_t) i * row_words + (j >> 6)] >> (j & 63)) & 1) == 0;  // у свободной клетки соответствующий бит равен 0
+}
+
+
+int Map::get_clearance(int i, int j) {
+    /*
+    Данная функция возвращает расстояние max(|di|, |dj|) от клетки (i,j) до ближайшей занятой клетки (или края карты):
+    все клетки, которые ближе этого расстояния, гарантированно свободны и лежат на карте.
+    */
+
+    return clearance[(size_t) i * width + j];
+}
+
+
+int Map::get_component(int i, int j) {
+    /*
+    Данная функция возвращает номер компоненты связности клетки (i,j) (-1, если клетка занята).
+    */
+
+    if (!components_valid)  // карта изменилась -> компоненты пересчитываем при первом обращении после изменения
+        calc_components();
+    return component[(size_t) i * width + j];
+}
+
+
+void Map::block_clearance(int i, int j) {
+    /*
+    Данная функция обновляет clearance после того, как клетка (i,j) стала занятой: расстояния могут только уменьшиться,
+    причём только у клеток, которые к (i,j) ближе, чем к прежнему ближайшему препятствию. Клетки обходятся "кольцами"
+    всё большего радиуса d вокруг (i,j); если на кольце d ни одно значение не уменьшилось, то и дальше уменьшаться
+    нечему (у соседа клетки на кольце d+1, лежащего на кольце d, clearance отличается не больше, чем на 1).
+    */
+
+    uint16_t *d = own_clearance.data();
+    d[(size_t) i * width + j] = 0;
+    for (int r = 1; ; r ++) {
+        bool changed = 0;
+        for (int ii = i - r; ii <= i + r; ii ++)
+            for (int jj = j - r; jj <= j + r; jj += (ii == i - r || ii == i + r) ? 1 : 2 * r) {  // только клетки кольца
+                if (in_bounds(ii, jj) && d[(size_t) ii * width + jj] > r) {
+                    d[(size_t) ii * width + jj] = r;
+                    changed = 1;
+                }
+            }
+        if (!changed)
+            break;
+    }
+}
+
+
+vector <pair <int, int>> Map::set_cells(const vector <CellUpdate> &updates) {
+    /*
+    Данная функция меняет клетки карты (например, появилось или исчезло препятствие) и возвращает список клеток, которые
+    действительно изменились (клетки за пределами карты и клетки, которые уже были такими, пропускаются) - именно его
+    нужно передать поиску, который перестраивает путь (см. KC_replanning.hpp).
+    Если карта была отображена из кэша, то при первом изменении её массивы копируются в память процесса. clearance
+    обновляется сразу (если клетки только занимались - лишь вокруг них, иначе - целиком), а компоненты связности -
+    при первом обращении к ним. Маски тупиков (KC_deadends.hpp), посчитанные для старой карты, при этом устаревают.
+    */
+
+    if (own_cells.empty() && height > 0) {  // карта лежит в отображённом кэше -> копируем
+        own_cells.assign(cells, cells + (size_t) height * row_words);
+        own_clearance.assign(clearance, clearance + (size_t) height * width);
+        cells = own_cells.data();
+        clearance = own_clearance.data();
+    }
+
+    vector <pair <int, int>> changed;
+    bool freed = 0;  // стала ли какая-нибудь клетка свободной
+    for (const CellUpdate &u: updates) {
+        if (!in_bounds(u.i, u.j) || traversable(u.i, u.j) != u.occupied)
+            continue;
+        own_cells[(size_t) u.i * row_words + (u.j >> 6)] ^= uint64_t(1) << (u.j & 63);
+        changed.push_back({u.i, u.j});
+        freed |= !u.occupied;
+    }
+    if (changed.empty())
+        return changed;
+
+    if (freed)  // расстояния могли и увеличиться -> считаем заново
+        calc_clearance();
+    else
+        for (auto &c: changed)
+            block_clearance(c.first, c.second);
+    components_valid = 0;
+    return changed;
 }
 
 
@@ -169,21 +499,26 @@ bool VertexEqual::operator() (ptrVertex const &v1, ptrVertex const &v2) const {
 
 
 
-SearchTree::SearchTree(bool fast) {
+SearchTree::SearchTree(bool fast, int height, int width, int info_amount) {
     /*
     Конструктор. Просто инициализирует дерево поиска.
+    Размеры height, width карты и количество info_amount различных значений theta (= info) у вершин нужны только для
+    fast_closed: в нём ровно по биту на каждую возможную вершину.
     */
 
     use_fast_closed = fast;
+    closed_height = height;
+    closed_width = width;
+    closed_info = info_amount;
 
     if (fast)  // если используем массив в качестве CLOSED, инициализируем его
-        fast_closed.assign(MAX_MAP_HEIGHT * 1ll * MAX_MAP_WIDTH * 1ll * MAX_INFO / 8 + 1, 0);  // пока он заполнен 0 (в CLOSED пусто)
+        fast_closed.assign(height * 1ll * width * 1ll * info_amount / 8 + 1, 0);  // пока он заполнен 0 (в CLOSED пусто)
 }
 
 
-static inline size_t index_in_closed(ptrVertex item) {
+inline size_t SearchTree::index_in_closed(int i, int j, int theta) {
     /*
-    Данная функция по вершине item вычисляет номер бита в списке fast_closed. Причём делается это однозначно (для разных
+    Данная функция по вершине (i, j, theta) вычисляет номер бита в списке fast_closed. Причём делается это однозначно (для разных
     вершин (с точки зрения функции сравнения VertexEqual::operator()) будет разный индекс, для одинаковых - одинаковый),
     так как бит с этим номером должен характеризовать, лежит ли вершина в CLOSED или не лежит.
 
@@ -191,20 +526,19 @@ static inline size_t index_in_closed(ptrVertex item) {
     набор и однозначно сопоставить ему номер бита.
     */
 
-    // запишем имеющийся набор чисел, в комментариях после ":" указан диапазон значений
-    int i = item->i;  // координата: 0 ... MAX_MAP_HEIGHT-1
-    int j = item->j;  // координата: 0 ... MAX_MAP_WIDTH-1
-    int theta = item->theta;  // угол направления theta = информация для отличия info: 0 ... MAX_INFO-1
+    // в комментариях после ":" указан диапазон значений:
+    // i - координата: 0 ... closed_height-1
+    // j - координата: 0 ... closed_width-1
+    // theta - угол направления theta = информация для отличия info: 0 ... closed_info-1
 
-    rassert(0 <= i && i < MAX_MAP_HEIGHT &&
-            0 <= j && j < MAX_MAP_WIDTH &&
-            0 <= theta && theta < MAX_INFO &&
-            theta == item->info,
-            "Некорректные компоненты item!\n");  // проверяем, что все элементы находятся в нужно диапазоне значений
+    rassert(0 <= i && i < closed_height &&
+            0 <= j && j < closed_width &&
+            0 <= theta && theta < closed_info,
+            "Некорректные компоненты вершины!\n");  // проверяем, что все элементы находятся в нужно диапазоне значений
 
     // получаем одно число num по набору i,j,theta
     // (так как все эти числа i,j,theta лежат в указанных ранее диапазонах, то такое число num однозначно для каждого набора)
-    size_t num = theta * 1ll * MAX_MAP_HEIGHT * 1ll * MAX_MAP_WIDTH + i * 1ll * MAX_MAP_WIDTH + j;
+    size_t num = (theta * 1ll * closed_height + i) * closed_width + j;
     return num;
 }
 
@@ -224,6 +558,9 @@ void SearchTree::add_to_open(ptrSearchNode item) {
     */
 
     open.push(item);
+
+    STATS(stats.peak_open = max(stats.peak_open, (long long) open.size());
+          stats.peak_pool = max(stats.peak_pool, (long long) (HEAP->N - HEAP->index_free_nodes.size())));
 }
 
 
@@ -251,7 +588,7 @@ void SearchTree::add_to_closed(ptrSearchNode item) {
     else
         HEAP->delete_SearchNode(item);  // иначе больше нам вершина не нужна (так как попавшие в CLOSED больше не трогаются -> удаляем)  !!! так не делаем -удалим в деструкторе вместе с SearchNode
 
-    size_t num = index_in_closed(v);  // иначе - получаем номер бита, соответствующий данной вершине
+    size_t num = index_in_closed(v->i, v->j, v->info);  // иначе - получаем номер бита, соответствующий данной вершине
     fast_closed[num / 8] |= (1 << (num % 8));  // устанавливаем этот бит в 1 (это значит, что вершина раскрыта)
 }    
 
@@ -264,11 +601,40 @@ bool SearchTree::was_expanded(ptrVertex item) {
     if (use_fast_closed == 0)
         return (set_closed.count(item) > 0);
     
-    size_t num = index_in_closed(item);
+    size_t num = index_in_closed(item->i, item->j, item->info);
     return (fast_closed[num / 8] & (1 << (num % 8)));  // проверяем, что нужный бит = 1
 }
 
 
+bool SearchTree::was_expanded(int i, int j, int info) {
+    /*
+    То же для вершины, заданной только координатами и информацией для склеивания (углом) - так последователей
+    проверяют до того, как создавать их в куче (см. Successors).
+    */
+
+    if (use_fast_closed == 0) {  // хеш-множеству нужна вершина в куче -> создаём временную (VertexEqual сравнивает только i, j, info)
+        ptrVertex item = HEAP->new_Vertex(i, j, info);
+        bool res = (set_closed.count(item) > 0);
+        HEAP->delete_Vertex(item);
+        return res;
+    }
+
+    size_t num = index_in_closed(i, j, info);
+    return (fast_closed[num / 8] & (1 << (num % 8)));
+}
+
+
+void SearchTree::prefetch_closed(int i, int j, int info) {
+    /*
+    Данная функция заранее (без ожидания) подгружает в кэш процессора байт fast_closed, в котором лежит бит вершины
+    (i, j, info), - чтобы следующая проверка was_expanded не ждала память (см. KC_batch.hpp).
+    */
+
+    if (use_fast_closed)
+        __builtin_prefetch(&fast_closed[index_in_closed(i, j, info) / 8]);
+}
+
+
 ptrSearchNode SearchTree::get_best_node_from_open() {
     /*
     Функция, которая возвращает лучшую SearchNode (а точнее как бы указатель на неё - виде ptrSearchNode) из
@@ -282,14 +648,67 @@ ptrSearchNode SearchTree::get_best_node_from_open() {
         ptrSearchNode best_node = open.top();  // извлекаем лучшую вершину (вершину с минимальным f-значением, так как именно в таком порядке в OPEN (=очереди с приоритетами) они сортируются)
         open.pop();  // выкидываем её из очереди с приоритетами
 
-        if (was_expanded(best_node->vertex) == 1)  // если соответствующая вершина раскрыта, значит она дубликат
+        if (was_expanded(best_node->vertex) == 1) {  // если соответствующая вершина раскрыта, значит она дубликат
             HEAP->delete_SearchNode(best_node);  // удаляем ДУБЛИКАТ
-        else 
+            STATS(stats.duplicates += 1);
+        } else 
             return best_node;            // если НЕ дубликат, то возвращаем найденную вершину     
     }
 }
 
 
+void SearchTree::reorder_open() {
+    /*
+    Данная функция заново упорядочивает OPEN после того, как у его вершин изменились f-значения (например, при
+    продолжении поиска до другой цели - см. AstarContinue). Заодно из OPEN выкидываются дубликаты уже раскрытых вершин.
+    */
+
+    vector <ptrSearchNode> &nodes = open.nodes();
+    size_t kept = 0;
+    for (size_t k = 0; k < nodes.size(); k ++) {
+        if (was_expanded(nodes[k]->vertex) == 1) {
+            HEAP->delete_SearchNode(nodes[k]);
+            STATS(stats.duplicates += 1);
+        } else
+            nodes[kept ++] = nodes[k];
+    }
+    nodes.resize(kept);
+    open.reorder();
+}
+
+
+size_t SearchTree::nodes_amount() {
+    /*
+    Возвращает, сколько вершин поиска сейчас занимает дерево (в OPEN и в CLOSED) - это мера его памяти.
+    */
+
+    return open.size() + expanded_nodes.size();
+}
+
+
+size_t SearchTree::node_bytes() {
+    /*
+    Возвращает, сколько байт занимает одна вершина поиска дерева: SearchNode и её Vertex в куче и указатель на неё в
+    OPEN или в CLOSED.
+    */
+
+    return sizeof(SearchNode) + sizeof(Vertex) + sizeof(ptrSearchNode);
+}
+
+
+size_t SearchTree::memory_bytes() {
+    /*
+    Возвращает оценку памяти дерева в байтах: вершины поиска (по node_bytes на каждую) и то, что дерево занимает
+    независимо от их количества, - битовый fast_closed (выделяется сразу на всю карту), запас массивов OPEN и CLOSED
+    и хеш-таблица set_closed.
+    */
+
+    size_t spare = (open.nodes().capacity() - open.size()) + (expanded_nodes.capacity() - expanded_nodes.size());
+    return sizeof(SearchTree) + nodes_amount() * node_bytes() + fast_closed.capacity() + spare * sizeof(ptrSearchNode) +
+           set_closed.bucket_count() * sizeof(void *) + set_closed.size() * (sizeof(ptrVertex) + sizeof(void *));
+}
+
+
 SearchTree::~SearchTree() {
     /*
     Это деструктор. Он должен очистить занимаемую память.
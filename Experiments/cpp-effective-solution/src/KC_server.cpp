@@ -0,0 +1,536 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "KC_server.hpp"
+#include "KC_astar.hpp"
+
+
+
+
+void AssetRegistry::load(string file) {
+    /*
+    Данная функция загружает все карты, control set и типы, перечисленные в файле реестра file (формат см. в
+    KC_server.hpp), а затем маски тупиков для всех пар (карта, control set) и перечисленные иерархические абстракции.
+    */
+
+    ifstream in(file);
+    if (!in.is_open())
+        throw runtime_error("Не удалось открыть файл реестра: " + file);
+
+    map <string, string> map_files;  // имя карты -> файл (нужен для кэша тупиков)
+    map <string, string> control_set_files;
+    vector <pair <string, string>> hierarchy_pairs;  // (имя карты, имя control set) - строятся, когда всё загружено
+    string line;
+    int line_num = 0;
+    while (getline(in, line)) {
+        line_num += 1;
+        stringstream s(line);
+        string kind, name, path;
+        if (!(s >> kind) || kind[0] == '#')
+            continue;
+        if (!(s >> name >> path))
+            throw runtime_error("Некорректная строка " + to_string(line_num) + " в файле реестра: " + line);
+
+        if (kind == "map") {
+            if (maps.count(name)) throw runtime_error("Карта " + name + " указана в реестре дважды!");
+            maps[name] = new Map();
+            maps[name]->read_file_to_cells(path);
+            map_files[name] = path;
+            cout << "Загружена карта " << name << ": " << path << ", размеры: " << maps[name]->width << " " << maps[name]->height << endl;
+        } else if (kind == "control_set") {
+            if (control_sets.count(name)) throw runtime_error("Control set " + name + " указан в реестре дважды!");
+            control_sets[name] = new ControlSet();
+            control_sets[name]->load_primitives(path);
+            control_set_files[name] = path;
+            cout << "Загружен control set " << name << ": " << path << endl;
+        } else if (kind == "types") {
+            if (types.count(name)) throw runtime_error("Типы " + name + " указаны в реестре дважды!");
+            types[name] = new TypeInfo();
+            types[name]->load_types(path);
+            cout << "Загружены типы " << name << ": " << path << endl;
+        } else if (kind == "hierarchy") {
+            hierarchy_pairs.push_back({name, path});  // path - имя control set
+        } else {
+            throw runtime_error("Неизвестный вид файла в строке " + to_string(line_num) + " реестра: " + kind);
+        }
+    }
+
+    for (auto &t: types)  // control set и типы с одним именем используются вместе (в PARALL)
+        if (control_sets.count(t.first) && control_sets[t.first]->theta_amount != t.second->theta_amount)
+            throw runtime_error("Количество дискретных направлений в control set и в типах " + t.first + " не совпадает!");
+
+    for (auto &m: maps)  // маска тупиков для каждой пары (карта, control set) - кэшируется рядом с картой, как в test_algorithm
+        for (auto &c: control_sets) {
+            string prim_name = control_set_files[c.first].substr(control_set_files[c.first].find_last_of('/') + 1);
+            prim_name = prim_name.substr(0, prim_name.find_last_of('.'));
+            DeadEnds *dead = new DeadEnds();
+            dead->load_or_compute(m.second, c.second, map_files[m.first], map_files[m.first] + "." + prim_name + ".kdead");
+            dead_ends[make_pair(m.first, c.first)] = dead;
+        }
+
+    for (auto &pair: hierarchy_pairs) {  // абстракция тоже кэшируется рядом с картой
+        if (!maps.count(pair.first) || !control_sets.count(pair.second))
+            throw runtime_error("Для абстракции нет карты " + pair.first + " или control set " + pair.second + "!");
+        if (hierarchies.count(pair))
+            continue;
+        string prim_name = control_set_files[pair.second].substr(control_set_files[pair.second].find_last_of('/') + 1);
+        prim_name = prim_name.substr(0, prim_name.find_last_of('.'));
+        Hierarchy *hierarchy = new Hierarchy();
+        hierarchy->load_or_build(maps[pair.first], control_sets[pair.second], map_files[pair.first],
+                                 map_files[pair.first] + "." + prim_name + ".khpa");
+        hierarchies[pair] = hierarchy;
+        cout << "Загружена абстракция карты " << pair.first << " для " << pair.second << ": входов " << hierarchy->entrances_amount << endl;
+    }
+}
+
+
+AssetRegistry::~AssetRegistry() {
+    for (auto &d: dead_ends) delete d.second;
+    for (auto &h: hierarchies) delete h.second;
+    for (auto &m: maps) delete m.second;
+    for (auto &c: control_sets) delete c.second;
+    for (auto &t: types) delete t.second;
+}
+
+
+
+
+static string path_to_string(ptrSearchNode node, bool lattice, TypeInfo *type_info) {
+    /*
+    Данная функция выписывает путь, заканчивающийся в вершине поиска node, в виде "<n> <i j theta_или_тип> ...",
+    начиная со старта (по parent идём от конца, поэтому затем разворачиваем). На графе типов в parent хранятся только
+    целевые ячейки (см. set_parent), поэтому и путь получается из целевых ячеек, а типы выводятся в номерах файла
+    с типами type_info (при загрузке эквивалентные типы объединяются и перенумеровываются, см. TypeInfo::minimize).
+    */
+
+    vector <ptrVertex> path;
+    while (!(node == NULL_Node)) {
+        path.push_back(node->vertex);
+        node = node->parent;
+    }
+    reverse(path.begin(), path.end());
+
+    string res = to_string(path.size());
+    for (ptrVertex v: path)
+        res += " " + to_string(v->i) + " " + to_string(v->j) + " " + to_string(lattice ? v->theta : type_info->file_type_by_type[v->type]);
+    return res;
+}
+
+
+static string path_to_string(const vector <Vertex> &path) {
+    /*
+    То же для пути, который уже выписан по порядку дискретными состояниями (как у поиска по абстракции).
+    */
+
+    string res = to_string(path.size());
+    for (const Vertex &v: path)
+        res += " " + to_string(v.i) + " " + to_string(v.j) + " " + to_string(v.theta);
+    return res;
+}
+
+
+static void check_state(Map *map, int i, int j, int theta, int theta_amount, string name) {
+    /*
+    Проверяем, что состояние (i, j, theta) из запроса вообще лежит на карте.
+    */
+
+    if (!map->in_bounds(i, j))
+        throw runtime_error(name + " вне карты");
+    if (theta < 0 || theta >= theta_amount)
+        throw runtime_error(name + ": некорректное направление " + to_string(theta));
+}
+
+
+static double ms_since(chrono::steady_clock::time_point t0) {
+    return chrono::duration <double, milli> (chrono::steady_clock::now() - t0).count();
+}
+
+
+static string format_answer(string id, ResultSearch &res, double ms, TypeInfo *type_info) {
+    /*
+    Данная функция составляет строку ответа на запрос id по результату поиска res (формат см. в KC_server.hpp;
+    type_info - типы, с которыми искали, или NULL, если поиск был только на state lattice).
+    Путь восстанавливается от res.final_node, поэтому дерево поиска к этому моменту ещё не должно быть удалено.
+    */
+
+    if (res.find_path == 0)
+        return id + (res.out_of_time ? " timeout" : " not_found") + " -1 " + to_string(res.steps) + " " + to_string(ms);
+
+    bool lattice = (res.final_node->vertex->type == -1);  // в PARALL путь мог найти любой из двух поисков
+    stringstream cost;
+    cost << res.final_node->g;
+    return id + " found " + cost.str() + " " + to_string(res.steps) + " " + to_string(ms) + " " +
+           (lattice ? "lattice " : "types ") + path_to_string(res.final_node, lattice, type_info);
+}
+
+
+template <typename T>
+static vector <string> search_many(vector <T*> &params, vector <string> &ids, double budget_ms, chrono::steady_clock::time_point t0,
+                                   TypeInfo *type_info) {
+    /*
+    Данная функция ищет пути до всех целей params одним деревом поиска (см. AstarSearchMany), составляет ответы
+    (с номерами запросов ids) и очищает память.
+    */
+
+    vector <ResultSearch> results = AstarSearchMany(params, budget_ms / 1000);
+    double ms = ms_since(t0);
+    vector <string> answers;
+    for (size_t k = 0; k < params.size(); k ++)
+        answers.push_back(format_answer(ids[k], results[k], ms, type_info));
+    for (T *p: params) {  // финальные вершины лежат в CLOSED первого дерева -> удаляются вместе с ним
+        delete p->ast;
+        delete p;
+    }
+    return answers;
+}
+
+
+string answer_query(AssetRegistry &registry, string line, WorkerCaches *caches) {
+    /*
+    Данная функция выполняет один запрос line (формат см. в KC_server.hpp) и возвращает строку ответа (или несколько
+    строк через '\n', если в запросе несколько целей).
+    Ошибки в запросе не прерывают работу сервера, а возвращаются ответом "<id> error <сообщение>".
+    Если указаны caches, то запрос до одной цели продолжает сохранённое дерево поиска из того же старта (см. KC_reuse.hpp).
+    */
+
+    stringstream s(line);
+    string id, map_name, set_name, mode, word;
+    int si, sj, st, gi, gj, gt;
+    if (!(s >> id))
+        return "";
+    try {
+        if (!(s >> map_name >> set_name >> mode >> si >> sj >> st >> word))
+            throw runtime_error("некорректный запрос");
+        vector <Vertex> goals;
+        if (word == "goals") {  // несколько целей: goals <n> <gi> <gj> <gtheta> ...
+            int n;
+            if (!(s >> n) || n <= 0)
+                throw runtime_error("некорректное количество целей");
+            for (int k = 0; k < n; k ++) {
+                if (!(s >> gi >> gj >> gt))
+                    throw runtime_error("некорректный запрос");
+                goals.push_back(Vertex(gi, gj, gt));
+            }
+        } else {
+            stringstream first(word);
+            if (!(first >> gi) || !(s >> gj >> gt))
+                throw runtime_error("некорректный запрос");
+            goals.push_back(Vertex(gi, gj, gt));
+        }
+        long double R = 3.0;
+        int A = 1;
+        double budget_ms = 0;
+        if (s >> R) if (s >> A) s >> budget_ms;  // необязательные параметры
+
+        if (!registry.maps.count(map_name))
+            throw runtime_error("нет карты " + map_name);
+        Map *map = registry.maps[map_name];
+
+        int T = 0;  // параметр PARALL_T (0 - не PARALL)
+        if (mode.compare(0, 7, "PARALL_") == 0) {
+            T = atoi(mode.c_str() + 7);
+            if (T <= 0)
+                throw runtime_error("некорректный алгоритм " + mode);
+            if (word == "goals")
+                throw runtime_error("PARALL ищет путь только до одной цели");
+        } else if (mode == "HPA") {
+            if (word == "goals")
+                throw runtime_error("HPA ищет путь только до одной цели");
+        } else if (mode != "PRIM" && mode != "COST" && mode != "TYPES") {
+            throw runtime_error("некорректный алгоритм " + mode);
+        }
+        bool need_prims = (mode != "TYPES");
+        bool need_types = (mode == "TYPES" || T > 0);
+        if (need_prims && !registry.control_sets.count(set_name))
+            throw runtime_error("нет control set " + set_name);
+        if (need_types && !registry.types.count(set_name))
+            throw runtime_error("нет типов " + set_name);
+        ControlSet *control_set = need_prims ? registry.control_sets[set_name] : NULL;
+        TypeInfo *type_info = need_types ? registry.types[set_name] : NULL;
+        DeadEnds *dead_ends = need_prims ? registry.dead_ends[make_pair(map_name, set_name)] : NULL;
+
+        int theta_amount = need_prims ? control_set->theta_amount : type_info->theta_amount;
+        check_state(map, si, sj, st, theta_amount, "старт");
+        for (Vertex &goal: goals)
+            check_state(map, goal.i, goal.j, goal.theta, theta_amount, "финиш");
+
+        Vertex start(si, sj, st);
+        auto t0 = chrono::steady_clock::now();
+
+        if (T > 0) {  // === PARALL (всегда одна цель) ===
+            if (!may_reach(map, &start, &goals[0], R))  // старт и финиш в разных компонентах связности -> пути точно нет
+                return id + " rejected -1 0 " + to_string(ms_since(t0));
+            StateLatticeParams *prims = new StateLatticeParams(&start, &goals[0], map, control_set, true, "COST", R, A, dead_ends);
+            TypesGraphParams *types = new TypesGraphParams(&start, &goals[0], map, type_info, true, R, A);
+            ResultSearch res = PARALL(prims, types, T, budget_ms / 1000);
+            string answer = format_answer(id, res, ms_since(t0), type_info);
+            if (res.find_path == 1)
+                HEAP->delete_SearchNode(res.final_node);  // последняя вершина не лежит ни в OPEN, ни в CLOSED
+            delete prims->ast; delete prims;
+            delete types->ast; delete types;
+            return answer;
+        }
+
+        if (mode == "HPA") {  // === поиск по иерархической абстракции (всегда одна цель) ===
+            if (!registry.hierarchies.count(make_pair(map_name, set_name)))
+                throw runtime_error("нет абстракции карты " + map_name + " для " + set_name);
+            if (!may_reach(map, &start, &goals[0], R))
+                return id + " rejected -1 0 " + to_string(ms_since(t0));
+            Hierarchy *hierarchy = registry.hierarchies[make_pair(map_name, set_name)];
+            ResultHierarchy res = hierarchy->find_path(map, control_set, &start, &goals[0], R, A, budget_ms / 1000);
+            double ms = ms_since(t0);
+            if (res.find_path == 0)
+                return id + (res.out_of_time ? " timeout" : " not_found") + " -1 " + to_string(res.steps) + " " + to_string(ms);
+            stringstream cost;
+            cost << res.cost;
+            return id + " found " + cost.str() + " " + to_string(res.steps) + " " + to_string(ms) + " lattice " + path_to_string(res.path);
+        }
+
+        // === PRIM, COST, TYPES: все цели ищутся одним деревом поиска ===
+        vector <string> answers(goals.size());
+        vector <string> ids;  // номера запросов для целей, до которых стоит искать путь
+        vector <int> searched;  // и сами эти цели
+        for (size_t k = 0; k < goals.size(); k ++) {
+            string goal_id = (word == "goals" ? id + "." + to_string(k) : id);  // у каждой из нескольких целей свой номер
+            if (!may_reach(map, &start, &goals[k], R))
+                answers[k] = goal_id + " rejected -1 0 " + to_string(ms_since(t0));
+            else {
+                ids.push_back(goal_id);
+                searched.push_back(k);
+            }
+        }
+
+        vector <string> found;
+        if (caches != NULL && word != "goals" && searched.size() == 1) {  // одна цель -> продолжаем дерево из того же старта, если оно есть
+            stringstream key;  // всё, от чего зависит дерево поиска
+            key << map_name << " " << set_name << " " << mode << " " << si << " " << sj << " " << st << " " << R << " " << A;
+            ResultSearch res(0, 0, NULL_Node);
+            if (need_types)
+                res = caches->types.search(key.str(), start, goals[0], [&](Vertex *s, Vertex *f) {
+                    return new TypesGraphParams(s, f, map, type_info, true, R, A);
+                }, budget_ms / 1000);
+            else
+                res = caches->lattice.search(key.str(), start, goals[0], [&](Vertex *s, Vertex *f) {
+                    return new StateLatticeParams(s, f, map, control_set, true, mode, R, A, dead_ends);
+                }, budget_ms / 1000);
+            found.push_back(format_answer(ids[0], res, ms_since(t0), type_info));  // финальная вершина остаётся в дереве -> не удаляем
+            caches->lattice.shrink();  // путь уже выписан -> лишние деревья можно удалять
+            caches->types.shrink();
+        } else if (!searched.empty() && need_types) {
+            vector <TypesGraphParams*> params;
+            for (size_t t = 0; t < searched.size(); t ++)  // быстрый CLOSED нужен только дереву первой цели (см. AstarSearchMany)
+                params.push_back(new TypesGraphParams(&start, &goals[searched[t]], map, type_info, t == 0, R, A));
+            found = search_many(params, ids, budget_ms, t0, type_info);
+        } else if (!searched.empty()) {
+            vector <StateLatticeParams*> params;
+            for (size_t t = 0; t < searched.size(); t ++)
+                params.push_back(new StateLatticeParams(&start, &goals[searched[t]], map, control_set, t == 0, mode, R, A, dead_ends));
+            found = search_many(params, ids, budget_ms, t0, type_info);
+        }
+        for (size_t t = 0; t < searched.size(); t ++)
+            answers[searched[t]] = found[t];
+
+        string answer = answers[0];
+        for (size_t k = 1; k < answers.size(); k ++)
+            answer += "\n" + answers[k];
+        return answer;
+
+    } catch (exception &e) {
+        return id + " error " + e.what();
+    }
+}
+
+
+
+
+QueryClient::QueryClient(int fd, bool close_fd) {
+    this->fd = fd;
+    this->close_fd = close_fd;
+}
+
+
+void QueryClient::reply(const string &line) {
+    /*
+    Отправляем клиенту строку ответа line (целиком, даже если write записал её не за один раз).
+    Если клиент уже отключился, ответ просто теряется.
+    */
+
+    string data = line + "\n";
+    lock_guard <mutex> guard(write_lock);
+    size_t done = 0;
+    while (done < data.size()) {
+        ssize_t written = write(fd, data.data() + done, data.size() - done);
+        if (written <= 0)
+            return;
+        done += written;
+    }
+}
+
+
+QueryClient::~QueryClient() {
+    if (close_fd)
+        ::close(fd);
+}
+
+
+
+
+QueryServer::QueryServer(AssetRegistry *registry, int threads, size_t kept_nodes) {
+    /*
+    Конструктор. Запускает threads потоков пула; каждый поток сохраняет между запросами деревья поиска общим размером
+    не больше kept_nodes вершин поиска на каждый вид поиска (0 - деревья не сохраняются).
+    */
+
+    this->registry = registry;
+    this->kept_nodes = kept_nodes;
+    finished = 0;
+    for (int k = 0; k < threads; k ++)
+        workers.push_back(thread(&QueryServer::worker_loop, this));
+}
+
+
+void QueryServer::submit(string line, shared_ptr <QueryClient> client) {
+    /*
+    Кладём запрос line от клиента client в очередь (его выполнит первый освободившийся поток пула).
+    */
+
+    {
+        lock_guard <mutex> guard(lock);
+        queue.push_back(make_pair(line, client));
+    }
+    has_work.notify_one();
+}
+
+
+void QueryServer::close() {
+    /*
+    Дожидаемся, пока потоки пула выполнят все запросы из очереди, и завершаем их.
+    */
+
+    {
+        lock_guard <mutex> guard(lock);
+        if (finished)
+            return;
+        finished = 1;
+    }
+    has_work.notify_all();
+    for (thread &w: workers)
+        w.join();
+}
+
+
+QueryServer::~QueryServer() {
+    close();
+}
+
+
+void QueryServer::worker_loop() {
+    /*
+    Данная функция выполняется каждым потоком пула: забирает запросы из очереди и отвечает на них.
+    */
+
+    HEAP = new MyHEAP();  // у каждого потока своя куча
+    WorkerCaches *caches = new WorkerCaches(kept_nodes);  // и свои сохранённые деревья поиска (их нужно удалить раньше кучи)
+    while (1) {
+        pair <string, shared_ptr <QueryClient>> job;
+        {
+            unique_lock <mutex> guard(lock);
+            has_work.wait(guard, [this]() { return finished || !queue.empty(); });
+            if (queue.empty())
+                break;  // finished и очередь пуста
+            job = move(queue.front());
+            queue.pop_front();
+        }
+        string answer = answer_query(*registry, job.first, caches);
+        if (!answer.empty())
+            job.second->reply(answer);
+    }
+    delete caches;
+    delete HEAP;
+}
+
+
+
+
+static void read_queries(int fd, QueryServer &server, shared_ptr <QueryClient> client) {
+    /*
+    Данная функция читает запросы (по строке) из файлового дескриптора fd, пока он не закончится, и отправляет их в пул.
+    */
+
+    string buffer;
+    char chunk[4096];
+    while (1) {
+        ssize_t got = read(fd, chunk, sizeof(chunk));
+        if (got <= 0)
+            break;
+        buffer.append(chunk, got);
+        size_t begin = 0, end;
+        while ((end = buffer.find('\n', begin)) != string::npos) {
+            server.submit(buffer.substr(begin, end - begin), client);
+            begin = end + 1;
+        }
+        buffer.erase(0, begin);
+    }
+    if (!buffer.empty())  // последняя строка без '\n'
+        server.submit(buffer, client);
+}
+
+
+int run_server(string registry_file, string socket_path, int threads, size_t kept_nodes) {
+    /*
+    Данная функция запускает сервер запросов: загружает реестр registry_file и отвечает на запросы из stdin
+    (если socket_path пуст или равен "-"; тогда сервер работает до конца stdin) или из Unix-сокета socket_path
+    (тогда сервер работает, пока его не остановят). threads - количество потоков пула (0 - по числу ядер),
+    kept_nodes - ограничение памяти на сохранённые деревья поиска (см. QueryServer).
+    */
+
+    signal(SIGPIPE, SIG_IGN);  // отключившийся клиент не должен завершать весь сервер
+    cout.rdbuf(cerr.rdbuf());  // stdout занят ответами -> сообщения загрузчиков (и прочий вывод) пишем в stderr
+    if (threads <= 0)
+        threads = max(1u, thread::hardware_concurrency());
+
+    AssetRegistry registry;
+    registry.load(registry_file);
+    QueryServer server(&registry, threads, kept_nodes);
+
+    if (socket_path.empty() || socket_path == "-") {
+        cerr << "Сервер запущен (" << threads << " потоков), запросы читаются из stdin" << endl;
+        read_queries(0, server, make_shared <QueryClient> (1, false));
+        server.close();
+        return 0;
+    }
+
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0)
+        throw runtime_error("Не удалось создать сокет!");
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path))
+        throw runtime_error("Слишком длинный путь к сокету: " + socket_path);
+    strcpy(addr.sun_path, socket_path.c_str());
+    unlink(socket_path.c_str());  // сокет мог остаться от прошлого запуска
+    if (bind(listen_fd, (struct sockaddr *) &addr, sizeof(addr)) != 0 || listen(listen_fd, 64) != 0)
+        throw runtime_error("Не удалось открыть сокет: " + socket_path);
+    cerr << "Сервер запущен (" << threads << " потоков), сокет: " << socket_path << endl;
+
+    while (1) {
+        int fd = accept(listen_fd, NULL, NULL);
+        if (fd < 0)
+            continue;
+        // каждое подключение читает свой поток (запросы при этом выполняет общий пул); дескриптор закроется,
+        // когда клиент отключится и на все его запросы будет отправлен ответ
+        thread([fd, &server]() {
+            read_queries(fd, server, make_shared <QueryClient> (fd, true));
+        }).detach();
+    }
+}
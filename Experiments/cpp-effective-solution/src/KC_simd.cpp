@@ -0,0 +1,150 @@
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <stdexcept>
+#include <immintrin.h>
+
+#include "KC_simd.hpp"
+#include "common.hpp"
+#include "rassert.hpp"
+
+static const double SQRT2 = 1.4142135623730951;  // sqrt(2), округлённый до double
+
+#if defined(__AVX512F__)
+// _mm512_cvtepi32_pd и _mm512_sqrt_pd внутри берут неинициализированный вектор, и g++ 12 при -flto выдаёт на это
+// ложное предупреждение -Wmaybe-uninitialized -> используем варианты с маской и явным нулевым вектором (результат тот же)
+#define CVT_PD512(x) _mm512_mask_cvtepi32_pd(_mm512_setzero_pd(), 0xFF, x)
+#define SQRT_PD512(x) _mm512_mask_sqrt_pd(_mm512_setzero_pd(), 0xFF, x)
+#endif
+
+
+
+
+void SuccessorBatch::resize(size_t n) {
+    /*
+    Данная функция увеличивает массивы так, чтобы в них помещалось n последователей (уменьшать их незачем).
+    */
+
+    if (i.size() < n) {
+        i.resize(n);
+        j.resize(n);
+        h.resize(n);
+    }
+}
+
+
+void SuccessorBatch::gather(const Successors &succ_list) {
+    /*
+    Данная функция раскладывает координаты последователей succ_list (распаковывая их ключи) по массивам i и j.
+    */
+
+    int n = succ_list.size;
+    resize(n);
+    for (int k = 0; k < n; k ++) {
+        i[k] = state_i(succ_list.key[k]);
+        j[k] = state_j(succ_list.key[k]);
+    }
+}
+
+
+
+
+void euclid_batch_scalar(const int *i, const int *j, int n, int goal_i, int goal_j, double *h) {
+    /*
+    Скалярный вариант: h[k] - евклидово расстояние от (i[k], j[k]) до (goal_i, goal_j).
+    */
+
+    for (int k = 0; k < n; k ++) {
+        double di = i[k] - goal_i, dj = j[k] - goal_j;
+        h[k] = sqrt(di * di + dj * dj);  // (квадрат - целое число меньше 2^53, так что считается точно)
+    }
+}
+
+
+void octile_batch_scalar(const int *i, const int *j, int n, int goal_i, int goal_j, double *h) {
+    /*
+    Скалярный вариант: h[k] - octile distance от (i[k], j[k]) до (goal_i, goal_j).
+    */
+
+    for (int k = 0; k < n; k ++) {
+        double di = abs(i[k] - goal_i), dj = abs(j[k] - goal_j);
+        h[k] = fma(SQRT2, min(di, dj), max(di, dj) - min(di, dj));
+    }
+}
+
+
+
+
+#ifdef SIMD_CHECK
+static void check_batch(void (*scalar)(const int*, const int*, int, int, int, double*),
+                        const int *i, const int *j, int n, int goal_i, int goal_j, const double *h) {
+    /*
+    Режим проверки: пересчитываем пакет скалярно и сравниваем с векторным результатом h побитово.
+    */
+
+    vector <double> expected(n);
+    scalar(i, j, n, goal_i, goal_j, expected.data());
+    if (memcmp(expected.data(), h, n * sizeof(double)) != 0)  // (не rassert: проверка нужна и без DEBUG)
+        throw runtime_error("Векторное ядро эвристики разошлось со скалярным!");
+}
+#define CHECK_BATCH(scalar) check_batch(scalar, i, j, n, goal_i, goal_j, h)
+#else
+#define CHECK_BATCH(scalar)
+#endif
+
+
+void euclid_batch(const int *i, const int *j, int n, int goal_i, int goal_j, double *h) {
+    /*
+    Данная функция для всех k < n записывает в h[k] евклидово расстояние от (i[k], j[k]) до (goal_i, goal_j).
+    */
+
+    int k = 0;
+#if defined(__AVX512F__)
+    __m512d gi = _mm512_set1_pd(goal_i), gj = _mm512_set1_pd(goal_j);
+    for (; k + 8 <= n; k += 8) {
+        __m512d di = _mm512_sub_pd(CVT_PD512(_mm256_loadu_si256((const __m256i*) (i + k))), gi);
+        __m512d dj = _mm512_sub_pd(CVT_PD512(_mm256_loadu_si256((const __m256i*) (j + k))), gj);
+        _mm512_storeu_pd(h + k, SQRT_PD512(_mm512_add_pd(_mm512_mul_pd(di, di), _mm512_mul_pd(dj, dj))));
+    }
+#elif defined(__AVX2__)
+    __m256d gi = _mm256_set1_pd(goal_i), gj = _mm256_set1_pd(goal_j);
+    for (; k + 4 <= n; k += 4) {
+        __m256d di = _mm256_sub_pd(_mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i*) (i + k))), gi);
+        __m256d dj = _mm256_sub_pd(_mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i*) (j + k))), gj);
+        _mm256_storeu_pd(h + k, _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(di, di), _mm256_mul_pd(dj, dj))));
+    }
+#endif
+    euclid_batch_scalar(i + k, j + k, n - k, goal_i, goal_j, h + k);  // хвост пакета (или весь пакет без AVX)
+    CHECK_BATCH(euclid_batch_scalar);
+}
+
+
+void octile_batch(const int *i, const int *j, int n, int goal_i, int goal_j, double *h) {
+    /*
+    Данная функция для всех k < n записывает в h[k] octile distance от (i[k], j[k]) до (goal_i, goal_j).
+    */
+
+    int k = 0;
+#if defined(__AVX512F__)
+    __m256i gi = _mm256_set1_epi32(goal_i), gj = _mm256_set1_epi32(goal_j);
+    __m512d sqrt2 = _mm512_set1_pd(SQRT2);
+    for (; k + 8 <= n; k += 8) {
+        __m256i ai = _mm256_abs_epi32(_mm256_sub_epi32(_mm256_loadu_si256((const __m256i*) (i + k)), gi));
+        __m256i aj = _mm256_abs_epi32(_mm256_sub_epi32(_mm256_loadu_si256((const __m256i*) (j + k)), gj));
+        __m512d lo = CVT_PD512(_mm256_min_epi32(ai, aj)), hi = CVT_PD512(_mm256_max_epi32(ai, aj));
+        _mm512_storeu_pd(h + k, _mm512_fmadd_pd(sqrt2, lo, _mm512_sub_pd(hi, lo)));
+    }
+#elif defined(__AVX2__) && defined(__FMA__)
+    __m128i gi = _mm_set1_epi32(goal_i), gj = _mm_set1_epi32(goal_j);
+    __m256d sqrt2 = _mm256_set1_pd(SQRT2);
+    for (; k + 4 <= n; k += 4) {
+        __m128i ai = _mm_abs_epi32(_mm_sub_epi32(_mm_loadu_si128((const __m128i*) (i + k)), gi));
+        __m128i aj = _mm_abs_epi32(_mm_sub_epi32(_mm_loadu_si128((const __m128i*) (j + k)), gj));
+        __m256d lo = _mm256_cvtepi32_pd(_mm_min_epi32(ai, aj)), hi = _mm256_cvtepi32_pd(_mm_max_epi32(ai, aj));
+        _mm256_storeu_pd(h + k, _mm256_fmadd_pd(sqrt2, lo, _mm256_sub_pd(hi, lo)));
+    }
+#endif
+    octile_batch_scalar(i + k, j + k, n - k, goal_i, goal_j, h + k);
+    CHECK_BATCH(octile_batch_scalar);
+}
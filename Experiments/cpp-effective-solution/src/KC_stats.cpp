@@ -0,0 +1,35 @@
+#include <algorithm>
+
+#include "KC_stats.hpp"
+
+
+
+
+SearchStats::SearchStats() {
+    /*
+    Конструктор. Изначально все счётчики нулевые.
+    */
+
+    generated = expanded = duplicates = pruned_closed = pruned_dead_ends = 0;
+    peak_open = peak_pool = 0;
+    check_prim_calls = collision_cells = 0;
+}
+
+
+void SearchStats::merge(const SearchStats &other) {
+    /*
+    Данная функция добавляет к текущей статистике статистику other (это нужно, например, в PARALL, где
+    поиск идёт сразу в двух деревьях). Счётчики складываются, а пиковые значения берутся максимальные.
+    */
+
+    generated += other.generated;
+    expanded += other.expanded;
+    duplicates += other.duplicates;
+    pruned_closed += other.pruned_closed;
+    pruned_dead_ends += other.pruned_dead_ends;
+    peak_open = max(peak_open, other.peak_open);
+    peak_pool = max(peak_pool, other.peak_pool);
+    check_prim_calls += other.check_prim_calls;
+    collision_cells += other.collision_cells;
+}
+
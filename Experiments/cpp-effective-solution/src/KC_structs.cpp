@@ -2,12 +2,15 @@
 #include <fstream>
 #include <sstream>
 #include <map>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
 
 #include "KC_structs.hpp"
 #include "common.hpp"
 #include "rassert.hpp"
 
-extern MyHEAP* HEAP;
+extern thread_local MyHEAP* HEAP;
 
 
 
@@ -40,60 +43,87 @@ Vertex::Vertex(int i, int j, int type, int info) {
 
 
 
-Primitive::Primitive() {
-    /*
-    Конструктор: при инициализации примитива просто резервируем в памяти вершину Vertex
-    (которая будет использоваться в виде дискретного состояния).
-    */
-    goal = HEAP->new_Vertex(0, 0, 0);
+
+Successors::Successors() {
+    size = capacity = 0;
 }
 
 
-void Primitive::add_collision(int i, int j) {
+void Successors::reserve(int capacity) {
     /*
-    Функция для добавления клетки (i,j) в список коллизий.
+    Данная функция выделяет память под capacity последователей (если её ещё не хватает).
     */
 
-    collision_in_i.push_back(i);
-    collision_in_j.push_back(j);
+    if (capacity <= this->capacity)
+        return;
+    this->capacity = capacity;
+    key.resize(capacity);
+    info.resize(capacity);
+    cost.resize(capacity);
 }
 
 
-void Primitive::calc_collision() {  
+
+
+Primitive::Primitive(): goal(0, 0, 0) {
     /*
-    Функция считает стоимость коллизионного следа примитива.
-    Заметим, что тут важно, чтобы клетки (i,j) в collision_in_i и collision_in_j
-    были перечислены в порядке прохождения по ним примитива.
+    Конструктор: пустой примитив (все поля заполняются в ControlSet::build_primitives).
     */
 
-    collision_cost = 0;
-    for (size_t k = 0; k + 1 < collision_in_i.size(); k ++) {  // перебираем номер клетки (= степень в примитиве)
-        int di = collision_in_i[k+1] - collision_in_i[k];  // считаем шаговый сдвиг из k-ой клетки в k+1-ую
-        int dj = collision_in_j[k+1] - collision_in_j[k];
-        collision_cost += sqrtf64x(di * di + dj * dj);  // добавляем стоимость перехода (1 по стороне, sqrt(2) по углу)
-    }
+    start_theta = 0;
+    collision_in_i = collision_in_j = NULL;
+    coll_sign_i = coll_sign_j = 1;
+    collision_size = 0;
+    traj_in_i = traj_in_j = NULL;
+    traj_size = 0;
+    reach = 0;
+    length = collision_cost = 0;
+    turning = 0;
 }
 
 
-Primitive::~Primitive() {
-    /*
-    Деструктор. Его задача высвободить всю память, которая была выделена под примитив. Все
-    векторы (std::vector) освободят свою память автоматически, поэтому единственное, что
-    нужно освободить - это выделенную вершину, использовавшуюся в качестве целевого дискретного состояния.
-    */
 
-    HEAP->delete_Vertex(goal);
-}
 
+#define CONTROL_SET_MAGIC "KCPRIMS"  // сигнатура скомпилированного файла с примитивами (8 байт вместе с завершающим нулём)
+#define CONTROL_SET_VERSION 4  // версия формата (увеличивать при любом изменении структуры файла)
 
 
+struct ControlSetHeader {
+    /*
+    Заголовок скомпилированного (бинарного) файла с примитивами. После него лежат массивы, смещения
+    которых (от начала файла) записаны в заголовке.
+    */
+
+    char magic[8];
+    uint32_t version;
+    uint32_t long_double_size;  // sizeof(long double) на машине, где файл скомпилирован (длины хранятся без потери точности)
+    uint32_t theta_amount;
+    uint32_t prims_amount;
+    uint64_t cells_amount;
+    uint32_t traj_coord_size;  // sizeof(traj_coord) (точки траекторий в половинной точности или в float)
+    uint32_t padding;
+    uint64_t points_amount;
+    uint64_t source_size;  // размер и время изменения текстового файла, из которого скомпилирован этот (см. compiled_from)
+    int64_t source_mtime;
+
+    uint64_t heading_begin, start_theta, goal_i, goal_j, goal_theta, turning;  // смещения массивов
+    uint64_t length, collision_cost;
+    uint64_t coll_begin, coll_source, coll_transform, coll_i, coll_j;
+    uint64_t traj_begin, traj_i, traj_j;
+};
+
 
 ControlSet::ControlSet() {
     /*
     Конструктор.
     */
 
-    control_set.assign(ANGLE_NUM, vector <Primitive *>());  // инициализируем список примитивов для каждого дискретного угла
+    theta_amount = 0;  // количество углов станет известно только при загрузке примитивов
+    prims_amount = 0;
+    cells_amount = 0;
+    points_amount = 0;
+    source_size = 0;
+    source_mtime = 0;
 }
 
 
@@ -104,23 +134,82 @@ static void check_theta(int theta) {
     */
 
     (void) theta;
-    rassert(0 <= theta && theta < ANGLE_NUM, "Угол направления (его номер) должен быть от 0 до ANGLE_NUM-1!");
+    rassert(0 <= theta && theta < MAX_ANGLE_NUM, "Угол направления (его номер) должен быть от 0 до MAX_ANGLE_NUM-1!");
+}
+
+
+static void transform_cell(int transform, int i, int j, int &ti, int &tj) {
+    /*
+    Данная функция применяет к клетке (i, j) преобразование симметрии сетки номер transform (от 0 до 7): если
+    выставлен бит 1, то координаты меняются местами (отражение относительно диагонали), затем бит 2 меняет
+    знак у i, а бит 4 - у j (отражения относительно осей). Результат записывается в (ti, tj).
+    */
+
+    if (transform & 1)
+        swap(i, j);
+    ti = (transform & 2) ? -i : i;
+    tj = (transform & 4) ? -j : j;
 }
 
 
-void ControlSet::load_primitives(string _file) {
+static int transform_theta(int transform, int theta, int theta_amount) {
     /*
-    Данная функция загружает из файла _file примитивы (файл имеет тот формат, что генерируется
-    кодом на Питоне), заполняя все структуры. 
+    Данная функция применяет преобразование transform (см. transform_cell) к дискретному направлению theta (всего
+    направлений theta_amount). Направление theta - это вектор (sin, cos) угла theta * 360 / theta_amount градусов в
+    координатах (i, j), поэтому обмен координат переводит угол a в 90-a, смена знака у i - в -a, а смена знака у j - в 180-a.
+    */
+
+    const int quarter = theta_amount / 4;  // номер направления, соответствующего 90 градусам
+    if (transform & 1)
+        theta = quarter - theta;
+    if (transform & 2)
+        theta = -theta;
+    if (transform & 4)
+        theta = 2 * quarter - theta;
+    return ((theta % theta_amount) + theta_amount) % theta_amount;
+}
+
+
+void ControlSet::load_primitives(string file) {
+    /*
+    Данная функция загружает примитивы из файла file: это либо текстовый файл того формата, что генерируется
+    кодом на Питоне, либо скомпилированный из него бинарный файл (программой compile_data) - какой из двух,
+    определяется по сигнатуре в начале файла.
+    */
+
+    if (file_starts_with(file, CONTROL_SET_MAGIC))
+        load_binary(file);
+    else
+        load_text(file);
+    build_primitives();
+
+    cout << "Примитивы загружены..." << endl;
+}
+
+
+void ControlSet::load_text(string _file) {
+    /*
+    Данная функция загружает из текстового файла _file примитивы (файл имеет тот формат, что генерируется
+    кодом на Питоне), заполняя все массивы. 
     */
 
     ifstream file(_file);  // файл с примитивами открываем в виде потока
     rassert(file.is_open() == 1, "Файл с control set не открыт! Возможно, несуществующий файл!");
+    if (!file_stamp(_file, source_size, source_mtime))
+        source_size = source_mtime = 0;
+
+    struct TextPrim {  // примитив в том виде, в котором он читается из файла
+        int goal_i = 0, goal_j = 0, goal_theta = 0, turning = 0;
+        long double length = 0;
+        vector <int> coll_i, coll_j;
+        vector <traj_coord> traj_i, traj_j;
+    };
+    vector <vector <TextPrim>> by_heading(MAX_ANGLE_NUM);  // прочитанные примитивы по стартовому углу (в порядке файла)
     
     string line;  // очередная строка файла
 
-    Primitive* prim;  // сюда записываем примитив
-    int theta;  // угол, из которого примитив выходит
+    TextPrim prim;  // сюда записываем примитив
+    int theta = 0;  // угол, из которого примитив выходит
     string temp;  // временная строка для считывания информации
 
     // основной цикл для считывания примитивов - в нем на каждой итерации читаем очередную строку line 
@@ -129,7 +218,7 @@ void ControlSet::load_primitives(string _file) {
         stringstream stream(line);  // превращаем строку в поток для считывания из неё через ">>"
 
         if  (line.find("===== prim description: =====") == 0) {
-            prim = new Primitive();  // создаём новый примитив (делаем это через стандартную "кучу" из new, так как загрузка примитивов делается заранее и не тормозит алгоритм)
+            prim = TextPrim();  // начинаем новый примитив
             continue;
         }
 
@@ -142,21 +231,26 @@ void ControlSet::load_primitives(string _file) {
         }
 
         if (line.find("goal state (i, j, heading num):") == 0) {
-            stream >> temp >> temp >> temp >> temp >> temp >> temp >> prim->goal->i >> prim->goal->j >> prim->goal->theta;  // благодаря определённому в ptrVertex оператору "->" можем считывать поля goal, обращаясь к ним через "->"
-            check_theta(prim->goal->theta);
+            stream >> temp >> temp >> temp >> temp >> temp >> temp >> prim.goal_i >> prim.goal_j >> prim.goal_theta;
+            check_theta(prim.goal_theta);
         }
 
         if (line.find("length is:") == 0)
-            stream >> temp >> temp >> prim->length;
+            stream >> temp >> temp >> prim.length;
 
         if (line.find("turning on:") == 0)
-            stream >> temp >> temp >> prim->turning;
+            stream >> temp >> temp >> prim.turning;
 
         if (line.find("trajectory is:") == 0) {
-            while (1) {  // в этом цикле просто в никуда читаем координаты точек примитива (они были нужны только для отрисовки, в коде C++ они не нужны)
+            while (1) {  // точки траектории записаны как (x, y), причём x идёт вдоль j, а y - вдоль i
                 getline(file, line);
                 if (line.find("---") == 0)
                     break;
+                stringstream stream(line);
+                double x, y;
+                stream >> x >> y;
+                prim.traj_i.push_back((traj_coord) y);
+                prim.traj_j.push_back((traj_coord) x);
             }
         }
 
@@ -168,20 +262,318 @@ void ControlSet::load_primitives(string _file) {
                 stringstream stream(line);
                 int i, j;
                 stream >> i >> j;
-                prim->add_collision(i, j);
+                prim.coll_i.push_back(i);
+                prim.coll_j.push_back(j);
             }
         }
                 
-        if (line.find("prim end") == 0) {  // после окончания прочтения примитива, сохраняем информацию о нём:
-            prim->start_theta = theta;
-            prim->calc_collision();  // подсчитываем стоимость коллизионного следа
-            control_set[theta].push_back(prim);  // добавляем примитив в control_set
-        }
+        if (line.find("prim end") == 0)  // после окончания прочтения примитива, сохраняем информацию о нём:
+            by_heading[theta].push_back(prim);
     }
     
     file.close();
 
-    cout << "Примитивы загружены..." << endl;
+    // количество дискретных направлений определяется по самому большому стартовому углу:
+    theta_amount = 0;
+    for (int t = 0; t < MAX_ANGLE_NUM; t ++)
+        if (!by_heading[t].empty())
+            theta_amount = t + 1;
+    for (int t = 0; t < theta_amount; t ++)
+        for (TextPrim &p: by_heading[t])
+            if (p.goal_theta >= theta_amount)
+                throw runtime_error("Примитив кончается под углом, под которым не начинается ни один примитив: " + _file);
+
+    // проверяем, не является ли примитив p образом уже сохранённого примитива q при преобразовании transform
+    // (при количестве углов, не делящемся на 4, сетка углов не переходит в себя и симметрии не ищем):
+    auto is_image = [&](TextPrim &p, int p_theta, TextPrim &q, int q_theta, int transform) {
+        int gi, gj;
+        transform_cell(transform, q.goal_i, q.goal_j, gi, gj);
+        if (theta_amount % 4 != 0 || transform_theta(transform, q_theta, theta_amount) != p_theta || gi != p.goal_i || gj != p.goal_j ||
+            transform_theta(transform, q.goal_theta, theta_amount) != p.goal_theta || q.length != p.length || q.turning != p.turning ||
+            q.coll_i.size() != p.coll_i.size())
+            return 0;
+        for (size_t k = 0; k < p.coll_i.size(); k ++) {
+            int ci, cj;
+            transform_cell(transform, q.coll_i[k], q.coll_j[k], ci, cj);
+            if (ci != p.coll_i[k] || cj != p.coll_j[k])
+                return 0;
+        }
+        return 1;
+    };
+
+    // теперь раскладываем примитивы по плоским массивам (по возрастанию стартового угла):
+    own_heading_begin.assign(1, 0);
+    own_coll_begin.assign(1, 0);
+    own_traj_begin.assign(1, 0);
+    vector <pair <TextPrim*, int>> canonical;  // примитивы с сохранённым следом (и их номера)
+    for (int t = 0; t < theta_amount; t ++) {
+        for (TextPrim &p: by_heading[t]) {
+            own_start_theta.push_back(t);
+            own_goal_i.push_back(p.goal_i);
+            own_goal_j.push_back(p.goal_j);
+            own_goal_theta.push_back(p.goal_theta);
+            own_turning.push_back(p.turning);
+            own_length.push_back(p.length);
+
+            // подсчитываем стоимость коллизионного следа. Заметим, что тут важно, чтобы клетки были
+            // перечислены в порядке прохождения по ним примитива:
+            long double collision_cost = 0;
+            for (size_t k = 0; k + 1 < p.coll_i.size(); k ++) {  // перебираем номер клетки (= степень в примитиве)
+                int di = p.coll_i[k+1] - p.coll_i[k];  // считаем шаговый сдвиг из k-ой клетки в k+1-ую
+                int dj = p.coll_j[k+1] - p.coll_j[k];
+                collision_cost += sqrtf64x(di * di + dj * dj);  // добавляем стоимость перехода (1 по стороне, sqrt(2) по углу)
+            }
+            own_collision_cost.push_back(collision_cost);
+
+            int k = own_start_theta.size() - 1;  // номер данного примитива
+            int source = k, transform = 0;
+            for (size_t c = 0; c < canonical.size() && source == k; c ++)
+                for (int tr = 0; tr < 8; tr ++)
+                    if (is_image(p, t, *canonical[c].first, own_start_theta[canonical[c].second], tr)) {
+                        source = canonical[c].second;
+                        transform = tr;
+                        break;
+                    }
+            own_coll_source.push_back(source);
+            own_coll_transform.push_back(transform);
+
+            if (source == k) {  // симметричного примитива не нашлось -> храним след целиком
+                canonical.push_back({&p, k});
+                own_coll_i.insert(own_coll_i.end(), p.coll_i.begin(), p.coll_i.end());
+                own_coll_j.insert(own_coll_j.end(), p.coll_j.begin(), p.coll_j.end());
+                own_traj_i.insert(own_traj_i.end(), p.traj_i.begin(), p.traj_i.end());  // траектория симметричного примитива -
+                own_traj_j.insert(own_traj_j.end(), p.traj_j.begin(), p.traj_j.end());  // образ траектории канонического
+            }
+            own_coll_begin.push_back(own_coll_i.size());
+            own_traj_begin.push_back(own_traj_i.size());
+        }
+        own_heading_begin.push_back(own_start_theta.size());
+    }
+
+    prims_amount = own_start_theta.size();
+    cells_amount = own_coll_i.size();
+    points_amount = own_traj_i.size();
+    heading_begin = own_heading_begin.data();
+    start_theta = own_start_theta.data();
+    goal_i = own_goal_i.data();
+    goal_j = own_goal_j.data();
+    goal_theta = own_goal_theta.data();
+    turning = own_turning.data();
+    length = own_length.data();
+    collision_cost = own_collision_cost.data();
+    coll_begin = own_coll_begin.data();
+    coll_source = own_coll_source.data();
+    coll_transform = own_coll_transform.data();
+    coll_i = own_coll_i.data();
+    coll_j = own_coll_j.data();
+    traj_begin = own_traj_begin.data();
+    traj_i = own_traj_i.data();
+    traj_j = own_traj_j.data();
+}
+
+
+void ControlSet::load_binary(string file) {
+    /*
+    Данная функция отображает в память скомпилированный файл file и просто направляет указатели на лежащие
+    в нём массивы (ничего не копируя и не разбирая).
+    */
+
+    if (!mapped.open(file))
+        throw runtime_error("Не удалось открыть файл с control set: " + file);
+
+    if (mapped.size < sizeof(ControlSetHeader))
+        throw runtime_error("Файл с control set повреждён: " + file);
+    const ControlSetHeader *h = mapped.at <ControlSetHeader> (0);
+    if (h->version != CONTROL_SET_VERSION || h->long_double_size != sizeof(long double) || h->traj_coord_size != sizeof(traj_coord))
+        throw runtime_error("Файл с control set скомпилирован другой версией программы (перекомпилируйте его): " + file);
+    if (h->theta_amount == 0 || h->theta_amount > MAX_ANGLE_NUM)
+        throw runtime_error("Количество углов в файле с control set должно быть от 1 до MAX_ANGLE_NUM: " + file);
+
+    // проверяем, что все массивы целиком лежат внутри файла:
+    auto check = [&](uint64_t offset, uint64_t bytes) {
+        if (offset % BINARY_ALIGN != 0 || offset + bytes > mapped.size)
+            throw runtime_error("Файл с control set повреждён: " + file);
+    };
+    uint64_t n = h->prims_amount, c = h->cells_amount, pts = h->points_amount;
+    check(h->heading_begin, (h->theta_amount + 1) * sizeof(int));
+    check(h->start_theta, n * sizeof(int));
+    check(h->goal_i, n * sizeof(int));
+    check(h->goal_j, n * sizeof(int));
+    check(h->goal_theta, n * sizeof(int));
+    check(h->turning, n * sizeof(int));
+    check(h->length, n * sizeof(long double));
+    check(h->collision_cost, n * sizeof(long double));
+    check(h->coll_begin, (n + 1) * sizeof(int));
+    check(h->coll_source, n * sizeof(int));
+    check(h->coll_transform, n * sizeof(int));
+    check(h->coll_i, c * sizeof(int));
+    check(h->coll_j, c * sizeof(int));
+    check(h->traj_begin, (n + 1) * sizeof(int));
+    check(h->traj_i, pts * sizeof(traj_coord));
+    check(h->traj_j, pts * sizeof(traj_coord));
+
+    theta_amount = h->theta_amount;
+    prims_amount = n;
+    cells_amount = c;
+    points_amount = pts;
+    source_size = h->source_size;
+    source_mtime = h->source_mtime;
+    heading_begin = mapped.at <int> (h->heading_begin);
+    start_theta = mapped.at <int> (h->start_theta);
+    goal_i = mapped.at <int> (h->goal_i);
+    goal_j = mapped.at <int> (h->goal_j);
+    goal_theta = mapped.at <int> (h->goal_theta);
+    turning = mapped.at <int> (h->turning);
+    length = mapped.at <long double> (h->length);
+    collision_cost = mapped.at <long double> (h->collision_cost);
+    coll_begin = mapped.at <int> (h->coll_begin);
+    coll_source = mapped.at <int> (h->coll_source);
+    coll_transform = mapped.at <int> (h->coll_transform);
+    coll_i = mapped.at <int> (h->coll_i);
+    coll_j = mapped.at <int> (h->coll_j);
+    traj_begin = mapped.at <int> (h->traj_begin);
+    traj_i = mapped.at <traj_coord> (h->traj_i);
+    traj_j = mapped.at <traj_coord> (h->traj_j);
+
+    if (heading_begin[0] != 0 || heading_begin[theta_amount] != prims_amount || coll_begin[0] != 0 ||
+        coll_begin[prims_amount] != cells_amount || traj_begin[0] != 0 || traj_begin[prims_amount] != points_amount)
+        throw runtime_error("Файл с control set повреждён: " + file);
+    for (int t = 0; t < theta_amount; t ++)  // границы групп по начальному углу не убывают
+        if (heading_begin[t] > heading_begin[t + 1])
+            throw runtime_error("Файл с control set повреждён: " + file);
+    for (int k = 0; k < prims_amount; k ++)  // углы корректны (и примитив лежит в группе своего начального угла),
+                                             // границы следов не убывают, а след берётся у канонического примитива
+        if (start_theta[k] < 0 || start_theta[k] >= theta_amount || goal_theta[k] < 0 || goal_theta[k] >= theta_amount ||
+            k < heading_begin[start_theta[k]] || k >= heading_begin[start_theta[k] + 1] ||
+            coll_source[k] < 0 || coll_source[k] >= prims_amount || coll_source[coll_source[k]] != coll_source[k] ||
+            coll_transform[k] < 0 || coll_transform[k] >= 8 || coll_begin[k] > coll_begin[k + 1] ||
+            traj_begin[k] > traj_begin[k + 1])
+            throw runtime_error("Файл с control set повреждён: " + file);
+}
+
+
+void ControlSet::save_binary(string file) {
+    /*
+    Данная функция сохраняет уже загруженные примитивы в скомпилированном бинарном формате в файл file.
+    */
+
+    ControlSetHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, CONTROL_SET_MAGIC, 8);
+    h.version = CONTROL_SET_VERSION;
+    h.long_double_size = sizeof(long double);
+    h.theta_amount = theta_amount;
+    h.prims_amount = prims_amount;
+    h.cells_amount = cells_amount;
+    h.traj_coord_size = sizeof(traj_coord);
+    h.points_amount = points_amount;
+    h.source_size = source_size;
+    h.source_mtime = source_mtime;
+
+    BinaryWriter out(sizeof(h));
+    h.heading_begin = out.add_array(heading_begin, theta_amount + 1);
+    h.start_theta = out.add_array(start_theta, prims_amount);
+    h.goal_i = out.add_array(goal_i, prims_amount);
+    h.goal_j = out.add_array(goal_j, prims_amount);
+    h.goal_theta = out.add_array(goal_theta, prims_amount);
+    h.turning = out.add_array(turning, prims_amount);
+    h.length = out.add_array(length, prims_amount);
+    h.collision_cost = out.add_array(collision_cost, prims_amount);
+    h.coll_begin = out.add_array(coll_begin, prims_amount + 1);
+    h.coll_source = out.add_array(coll_source, prims_amount);
+    h.coll_transform = out.add_array(coll_transform, prims_amount);
+    h.coll_i = out.add_array(coll_i, cells_amount);
+    h.coll_j = out.add_array(coll_j, cells_amount);
+    h.traj_begin = out.add_array(traj_begin, prims_amount + 1);
+    h.traj_i = out.add_array(traj_i, points_amount);
+    h.traj_j = out.add_array(traj_j, points_amount);
+    out.save(file, &h, sizeof(h));
+}
+
+bool ControlSet::compiled_from(string binary_file, string source_file) {
+    /*
+    Данная функция проверяет, что binary_file - скомпилированный текущей версией программы файл с примитивами, что он
+    скомпилирован из source_file в его нынешнем виде (совпадают размер и время изменения, как у кэшей карт) и что он
+    не повреждён (загружается без ошибок).
+    */
+
+    uint64_t size;
+    int64_t mtime;
+    MappedFile binary;
+    if (!file_stamp(source_file, size, mtime) || !file_starts_with(binary_file, CONTROL_SET_MAGIC) ||
+        !binary.open(binary_file) || binary.size < sizeof(ControlSetHeader))
+        return 0;
+    const ControlSetHeader *h = binary.at <ControlSetHeader> (0);
+    if (h->version != CONTROL_SET_VERSION || h->source_size != size || h->source_mtime != mtime)
+        return 0;
+
+    try {  // повреждённый файл тоже не годится (load_binary проверяет его целиком) -> тогда берётся текстовый
+        ControlSet check;
+        check.load_binary(binary_file);
+    } catch (const runtime_error &) {
+        return 0;
+    }
+    return 1;
+}
+
+
+uint64_t ControlSet::checksum() {
+    /*
+    Данная функция считает контрольную сумму всех данных примитивов, которые влияют на поиск (цели и коллизионные
+    следы). По ней кэши, посчитанные для конкретного control set (см. KC_deadends.hpp), понимают, что он не изменился.
+    */
+
+    uint64_t parts[] = {checksum64(heading_begin, (theta_amount + 1) * sizeof(int)),
+                        checksum64(goal_i, prims_amount * sizeof(int)),
+                        checksum64(goal_j, prims_amount * sizeof(int)),
+                        checksum64(goal_theta, prims_amount * sizeof(int)),
+                        checksum64(coll_begin, (prims_amount + 1) * sizeof(int)),
+                        checksum64(coll_source, prims_amount * sizeof(int)),
+                        checksum64(coll_transform, prims_amount * sizeof(int)),
+                        checksum64(coll_i, cells_amount * sizeof(int)),
+                        checksum64(coll_j, cells_amount * sizeof(int))};
+    return checksum64(parts, sizeof(parts));
+}
+
+
+void ControlSet::build_primitives() {
+    /*
+    Данная функция по уже заполненным массивам создаёт сами примитивы (они лишь ссылаются на
+    коллизионные следы внутри массивов) и раскладывает их по стартовым углам в control_set (и по финальным - в control_set_by_goal).
+    Симметричный примитив ссылается на след (и траекторию) своего канонического примитива: обмен координат делается просто
+    обменом указателей на массивы, а смена знаков - через coll_sign_i, coll_sign_j.
+    */
+
+    primitives.assign(prims_amount, Primitive());
+    control_set.assign(theta_amount, vector <Primitive *>());  // список примитивов для каждого дискретного угла
+    control_set_by_goal.assign(theta_amount, vector <Primitive *>());
+
+    for (int k = 0; k < prims_amount; k ++) {
+        Primitive &prim = primitives[k];
+        prim.start_theta = start_theta[k];
+        prim.goal = Vertex(goal_i[k], goal_j[k], goal_theta[k]);
+        int source = coll_source[k], transform = coll_transform[k];
+        prim.collision_in_i = coll_i + coll_begin[source];
+        prim.collision_in_j = coll_j + coll_begin[source];
+        if (transform & 1)
+            swap(prim.collision_in_i, prim.collision_in_j);
+        prim.coll_sign_i = (transform & 2) ? -1 : 1;
+        prim.coll_sign_j = (transform & 4) ? -1 : 1;
+        prim.collision_size = coll_begin[source+1] - coll_begin[source];
+        prim.traj_in_i = traj_i + traj_begin[source];  // траектория преобразуется так же, как след
+        prim.traj_in_j = traj_j + traj_begin[source];
+        if (transform & 1)
+            swap(prim.traj_in_i, prim.traj_in_j);
+        prim.traj_size = traj_begin[source+1] - traj_begin[source];
+        prim.reach = 0;
+        for (int c = 0; c < prim.collision_size; c ++)
+            prim.reach = max(prim.reach, max(abs(prim.collision_in_i[c]), abs(prim.collision_in_j[c])));
+        prim.length = length[k];
+        prim.collision_cost = collision_cost[k];
+        prim.turning = turning[k];
+        control_set[start_theta[k]].push_back(&prim);
+        control_set_by_goal[goal_theta[k]].push_back(&prim);
+    }
 }
 
 
@@ -196,74 +588,245 @@ vector <Primitive*> & ControlSet::get_prims_by_heading(int heading) {
 }
 
 
-ControlSet::~ControlSet() {
+vector <Primitive*> & ControlSet::get_prims_by_goal_heading(int heading) {
     /*
-    Деструктор. Высвобождает память.
+    Данная функция возвращает список примитивов, заканчивающихся в угле heading (то есть всех, по которым можно
+    приехать в состояние с этим углом).
     */
 
-    for (auto prims_list: control_set) 
-        for (Primitive *prim: prims_list)
-            delete prim;  // просто удаляем каждый примитив.
+    return control_set_by_goal[heading];
 }
 
 
+ControlSet::~ControlSet() {
+    /*
+    Деструктор. Вся память (векторы и отображённый файл) освобождается автоматически.
+    */
+}
+
+
+
+
+#define TYPES_MAGIC "KCTYPES"  // сигнатура скомпилированного файла с типами
+#define TYPES_VERSION 3
+
+
+struct TypesHeader {
+    /*
+    Заголовок скомпилированного (бинарного) файла с типами. После него лежат массивы, смещения
+    которых (от начала файла) записаны в заголовке.
+    */
+
+    char magic[8];
+    uint32_t version;
+    uint32_t long_double_size;
+    uint32_t theta_amount;
+    uint32_t types_amount;
+    uint32_t info_amount;
+    uint32_t successor_size;  // sizeof(TypeSuccessor)
+    uint64_t succ_amount;
+    uint32_t file_types_amount;
+    uint32_t reserved;
+    uint64_t source_size;  // размер и время изменения текстового файла, из которого скомпилирован этот (см. compiled_from)
+    int64_t source_mtime;
+
+    uint64_t succ_begin, succ, start_type_by_theta, goal_mask_by_type, goal_theta_by_type, add_info_by_type;  // смещения массивов
+    uint64_t file_type_by_type;
+};
 
 
 TypeInfo::TypeInfo() {
     /*
-    Конструктор. Инициализируем все списки исходя из максимально возможных количество типов и углов (которые
-    указаны в common.hpp)
+    Конструктор. Пока типов нет, все массивы пустые.
     */
-    
-    successors.assign(MAX_TYPES, vector <tuple <int, int, int>>()); 
-    start_type_by_theta.assign(ANGLE_NUM, -1); 
-    is_goal_by_theta_type.assign(ANGLE_NUM, vector <bool> (MAX_TYPES, 0));  // изначально заполняем все нулями (пока нет целевых ячеек)
-    add_info_by_type.assign(MAX_TYPES, 0); 
-    goal_theta_by_type.assign(MAX_TYPES, -1);  // пока что ни одна ячейка не целевая - только -1 ставим
+
+    static_assert(MAX_ANGLE_NUM <= 32, "Маска углов goal_mask_by_type хранится в uint32_t, поэтому MAX_ANGLE_NUM не больше 32!");
+
+    theta_amount = 0;
+    types_amount = info_amount = file_types_amount = 0;
+    succ_amount = 0;
+    succ_begin = start_type_by_theta = goal_theta_by_type = add_info_by_type = file_type_by_type = NULL;
+    succ = pred = NULL;
+    pred_begin = NULL;
+    goal_mask_by_type = NULL;
+    source_size = 0;
+    source_mtime = 0;
 }
 
 
-static void check_type_limit(int type) {
+static void check_type(int type) {
     /*
-    Данная функция должна проверить, что тип type укладывается в заданное ограничение.
+    Данная функция должна проверить, что номер типа type корректен.
     */
    
     (void) type;
-    rassert(0 <= type && type < MAX_TYPES, "В файле слишком много типов! Увеличьте значение MAX_TYPES в файле common.hpp! Также все типы >= 0!");
+    rassert(0 <= type, "Все типы должны быть >= 0!");
+}
+
+
+void TypeInfo::load_types(string file) {
+    /*
+    Функция, которая загружает всю необходимую информацию из файла file с типами: это либо текстовый файл (он
+    генерируется кодом на Питоне после нумерации конфигураций), либо скомпилированный из него бинарный файл.
+    */
+
+    if (file_starts_with(file, TYPES_MAGIC))
+        load_binary(file);  // (скомпилированный файл хранит уже объединённые типы)
+    else {
+        load_text(file);
+        minimize();
+    }
+    build_predecessors();
+
+    cout << "Типы загружены (" << types_amount << " из " << file_types_amount << " после объединения эквивалентных)..." << endl;
 }
 
 
-static size_t get_next_info(string &s) {
+void TypeInfo::minimize() {
     /*
-    Данная функция по строке s с информацией для склеивания вершин (эта строка в файле с типами берётся)
-    возвращает информацию в виде size_t-переменной. Для этого эта функция просто нумерует все встречаемые
-    строки, а номер возвращает в качестве результата.
+    Данная функция объединяет эквивалентные типы - такие, что поиск не отличит ячейку одного типа от ячейки другого
+    в той же клетке. Это бисимуляция: у эквивалентных типов одинаковые маска и угол целевой ячейки и информация для
+    склеивания, а соседи совпадают с точностью до эквивалентности (для каждого соседа (di, dj, t) одного типа есть
+    сосед (di, dj, t') другого с эквивалентным t'). Классы находятся измельчением разбиения: сначала типы делятся по
+    тому, что видно в самой ячейке, затем на каждой итерации - ещё и по набору (di, dj, класс соседа), пока количество
+    классов не перестанет расти.
+    Класс получает номер по порядку своего наименьшего типа, так что если объединять нечего, то типы не меняются.
     */
 
-    static size_t free_info = 0;  // переменная, обозначающая текущий свободный номер (так как переменная static, 
-                                  // она заводится только один раз - при первом запуске функции (и инициализируется 0),
-                                  // а дальше между запусками функции её значение сохраняется)
-    static map <string, size_t> all_info;  // словарь, который строке сопоставляет приписанный ей номер (словарь тоже static,
-                                           // поэтому при новом запуске функции он помнит своё значение с предыдущих запусков)
+    file_types_amount = types_amount;
+    vector <int> cls(types_amount);  // класс каждого типа
+    int classes = 0;
+    {
+        map <tuple <uint32_t, int, int>, int> ids;
+        for (int type = 0; type < types_amount; type ++)
+            cls[type] = ids.emplace(make_tuple(goal_mask_by_type[type], goal_theta_by_type[type], add_info_by_type[type]), ids.size()).first->second;
+        classes = ids.size();
+    }
+
+    while (1) {
+        map <pair <int, vector <tuple <int, int, int>>>, int> ids;  // (прежний класс, соседи с точностью до класса) -> новый класс
+        vector <int> next(types_amount);
+        for (int type = 0; type < types_amount; type ++) {
+            vector <tuple <int, int, int>> signature;
+            for (int k = succ_begin[type]; k < succ_begin[type + 1]; k ++)
+                signature.push_back(make_tuple(succ[k].di, succ[k].dj, cls[succ[k].type]));
+            sort(signature.begin(), signature.end());
+            signature.erase(unique(signature.begin(), signature.end()), signature.end());
+            next[type] = ids.emplace(make_pair(cls[type], signature), ids.size()).first->second;
+        }
+        cls = next;
+        if ((int) ids.size() == classes)  // разбиение больше не измельчается
+            break;
+        classes = ids.size();
+    }
+
+    // каждый класс представляет его наименьший тип (классы и пронумерованы по порядку наименьших типов):
+    vector <int> rep(classes, -1);
+    for (int type = types_amount - 1; type >= 0; type --)
+        rep[cls[type]] = type;
+
+    vector <int> new_succ_begin(1, 0);
+    vector <TypeSuccessor> new_succ;
+    for (int c = 0; c < classes; c ++) {
+        int type = rep[c];
+        for (int k = succ_begin[type]; k < succ_begin[type + 1]; k ++) {
+            TypeSuccessor s = succ[k];
+            s.type = cls[s.type];
+            bool seen = 0;  // соседи из эквивалентных типов в одну клетку теперь совпадают -> оставляем первого
+            for (int m = new_succ_begin.back(); m < (int) new_succ.size(); m ++)
+                if (new_succ[m].di == s.di && new_succ[m].dj == s.dj && new_succ[m].type == s.type)
+                    seen = 1;
+            if (!seen)
+                new_succ.push_back(s);
+        }
+        new_succ_begin.push_back(new_succ.size());
+    }
 
-    if (all_info.count(s) == 0) {  // если поданная на вход строка ещё не пронумерована (нет в словаре)
-        rassert(free_info < MAX_INFO, "Слишком много различных info-значений! Измените лимит MAX_INFO! в файле common.hpp!");
-        all_info[s] = free_info;  // нумеруем её
-        free_info += 1;  // сдвигаем число для номера следующих строк
+    vector <int> start_types(theta_amount), goal_theta(classes), add_info(classes);
+    vector <uint32_t> goal_mask(classes);
+    for (int theta = 0; theta < theta_amount; theta ++)
+        start_types[theta] = cls[start_type_by_theta[theta]];
+    for (int c = 0; c < classes; c ++) {
+        goal_mask[c] = goal_mask_by_type[rep[c]];
+        goal_theta[c] = goal_theta_by_type[rep[c]];
+        add_info[c] = add_info_by_type[rep[c]];
     }
 
-    return all_info[s];  // возвращаем номе строки
+    own_succ_begin = new_succ_begin;
+    own_succ = new_succ;
+    own_start_type_by_theta = start_types;
+    own_goal_mask_by_type = goal_mask;
+    own_goal_theta_by_type = goal_theta;
+    own_add_info_by_type = add_info;
+    own_file_type_by_type = rep;
+
+    types_amount = classes;
+    succ_amount = own_succ.size();
+    succ_begin = own_succ_begin.data();
+    succ = own_succ.data();
+    start_type_by_theta = own_start_type_by_theta.data();
+    goal_mask_by_type = own_goal_mask_by_type.data();
+    goal_theta_by_type = own_goal_theta_by_type.data();
+    add_info_by_type = own_add_info_by_type.data();
+    file_type_by_type = own_file_type_by_type.data();
 }
 
 
-void TypeInfo::load_types(string _file) {
+void TypeInfo::build_predecessors() {
     /*
-    Функция, которая загружает всю необходимую информацию из файла file с типами (этот файл
-    генерируется кодом на Питоне после нумерации конфигураций).
+    Данная функция по соседям succ строит предшественников pred (тем же подсчётом, что и CSR: сначала количество
+    предшественников каждого типа, затем раскладка).
+    */
+
+    own_pred_begin.assign(types_amount + 1, 0);
+    for (long long k = 0; k < succ_amount; k ++)
+        own_pred_begin[succ[k].type + 1] += 1;
+    for (int type = 0; type < types_amount; type ++)
+        own_pred_begin[type + 1] += own_pred_begin[type];
+
+    own_pred.resize(succ_amount);
+    vector <int> pos(own_pred_begin.begin(), own_pred_begin.end() - 1);  // куда класть очередного предшественника типа
+    for (int type = 0; type < types_amount; type ++)
+        for (int k = succ_begin[type]; k < succ_begin[type + 1]; k ++) {
+            TypeSuccessor r = succ[k];  // переход type -> succ[k].type, записываем его наоборот
+            r.di = -succ[k].di;
+            r.dj = -succ[k].dj;
+            r.type = type;
+            r.info = add_info_by_type[type];
+            own_pred[pos[succ[k].type] ++] = r;
+        }
+
+    pred_begin = own_pred_begin.data();
+    pred = own_pred.data();
+}
+
+
+void TypeInfo::load_text(string _file) {
+    /*
+    Функция, которая загружает всю необходимую информацию из текстового файла _file с типами.
     */
 
     ifstream file(_file);
     rassert(file.is_open() == 1, "Файл с типами не открылся! Возможно, несуществующий файл!");
+    if (!file_stamp(_file, source_size, source_mtime))
+        source_size = source_mtime = 0;
+
+    vector <vector <tuple <int, int, int>>> successors;  // сначала читаем соседей каждого типа в виде троек (di, dj, t)
+    vector <string> info_str;  // по типу - строка с информацией для склеивания
+    own_start_type_by_theta.assign(MAX_ANGLE_NUM, -1);
+    theta_amount = 0;  // определяется по самому большому углу, под которым начинаются примитивы
+    int max_goal_theta = -1;
+
+    auto add_type = [&](int type) {  // расширяем все массивы, чтобы в них был тип type
+        check_type(type);
+        if (type >= types_amount) {
+            types_amount = type + 1;
+            successors.resize(types_amount);
+            info_str.resize(types_amount);
+            own_goal_mask_by_type.resize(types_amount, 0);  // пока что ни одна ячейка не целевая
+            own_goal_theta_by_type.resize(types_amount, -1);
+        }
+    };
 
     string line;  // строка файла с типами
     string temp;  // временная строка для считывания информации
@@ -276,24 +839,26 @@ void TypeInfo::load_types(string _file) {
             int theta, type;
             stream >> temp >> temp >> temp >> theta >> temp >> temp >> type;
             check_theta(theta);
-            check_type_limit(type);
-            start_type_by_theta[theta] = type;
+            add_type(type);
+            own_start_type_by_theta[theta] = type;
+            theta_amount = max(theta_amount, theta + 1);
             continue;
         }
 
         if (line.find("in goal type:") == 0) {
             int theta, type;
             stream >> temp >> temp >> temp >> type >> temp >> temp >> temp >> temp >> temp;
-            check_type_limit(type);
+            add_type(type);
             
             int cnt = 0;
             while (stream >> theta) {  // пока можно, считываем углы theta, в которых заканчиваются примитивы в ячейке с типом type
                 cnt += 1;
                 check_theta(theta);
-                is_goal_by_theta_type[theta][type] = 1;  // указываем, что в ячейке типа type заканчивается примитив в угле theta
-                goal_theta_by_type[type] = theta;
+                max_goal_theta = max(max_goal_theta, theta);
+                own_goal_mask_by_type[type] |= (uint32_t(1) << theta);  // указываем, что в ячейке типа type заканчивается примитив в угле theta
+                own_goal_theta_by_type[type] = theta;
                 if (cnt >= 2)
-                    goal_theta_by_type[type] = -2;  // если несколько финальных углов, то указываем -2
+                    own_goal_theta_by_type[type] = -2;  // если несколько финальных углов, то указываем -2
             }
 
             continue;
@@ -302,7 +867,7 @@ void TypeInfo::load_types(string _file) {
         if (line.find("start type is:") == 0) {
             int type;
             stream >> temp >> temp >> temp >> type;
-            check_type_limit(type);
+            add_type(type);
 
             while (1) {
                 getline(file, line);
@@ -313,6 +878,7 @@ void TypeInfo::load_types(string _file) {
 
                 int di, dj, t;
                 stream >> di >> dj >> t;
+                add_type(t);
                 successors[type].push_back(make_tuple(di, dj, t));  // запоминаем соседей у типа
             }
 
@@ -322,17 +888,222 @@ void TypeInfo::load_types(string _file) {
         if (line.find("add_info for type:") == 0) {
             int type;
             stream >> temp >> temp >> temp >> type >> temp;
-            check_type_limit(type);
-
-            string str_info;
-            getline(stream, str_info);  // сохраняем в строку всю информацию для склеивания для типа type из файла
-            add_info_by_type[type] = get_next_info(str_info);  // получаем номер этой информации
-
+            add_type(type);
+            getline(stream, info_str[type]);  // сохраняем в строку всю информацию для склеивания для типа type из файла
             continue;
         }
     }
     
     file.close();
 
-    cout << "Типы загружены..." << endl;
+    if (max_goal_theta >= theta_amount)
+        throw runtime_error("Примитив кончается под углом, под которым не начинается ни один примитив: " + _file);
+    own_start_type_by_theta.resize(theta_amount);
+
+    // нумеруем все встречающиеся строки с информацией для склеивания (одинаковые строки - одинаковые номера):
+    map <string, int> all_info;
+    own_add_info_by_type.assign(types_amount, 0);
+    for (int type = 0; type < types_amount; type ++) {
+        if (all_info.count(info_str[type]) == 0) {
+            int free_info = all_info.size();
+            all_info[info_str[type]] = free_info;
+        }
+        own_add_info_by_type[type] = all_info[info_str[type]];
+    }
+    info_amount = all_info.size();
+
+    // раскладываем соседей в формат CSR:
+    own_succ_begin.assign(1, 0);
+    for (int type = 0; type < types_amount; type ++) {
+        for (auto triple: successors[type]) {
+            TypeSuccessor s;
+            s.di = get<0>(triple);
+            s.dj = get<1>(triple);
+            s.type = get<2>(triple);
+            s.info = own_add_info_by_type[s.type];
+            if (s.di == 0 || s.dj == 0)  // если переход в соседа по стороне (стороне клетки коллизионного следа), то стоимость 1
+                s.cost = 1;
+            else  // иначе - переход по углу, стоимость = корень из 2
+                s.cost = 1.41421356237L;
+            own_succ.push_back(s);
+        }
+        own_succ_begin.push_back(own_succ.size());
+    }
+
+    succ_amount = own_succ.size();
+    succ_begin = own_succ_begin.data();
+    succ = own_succ.data();
+    start_type_by_theta = own_start_type_by_theta.data();
+    goal_mask_by_type = own_goal_mask_by_type.data();
+    goal_theta_by_type = own_goal_theta_by_type.data();
+    add_info_by_type = own_add_info_by_type.data();
+}
+
+
+void TypeInfo::load_binary(string file) {
+    /*
+    Данная функция отображает в память скомпилированный файл file с типами и направляет указатели на лежащие в нём массивы.
+    */
+
+    if (!mapped.open(file))
+        throw runtime_error("Не удалось открыть файл с типами: " + file);
+
+    if (mapped.size < sizeof(TypesHeader))
+        throw runtime_error("Файл с типами повреждён: " + file);
+    const TypesHeader *h = mapped.at <TypesHeader> (0);
+    if (h->version != TYPES_VERSION || h->long_double_size != sizeof(long double) || h->successor_size != sizeof(TypeSuccessor))
+        throw runtime_error("Файл с типами скомпилирован другой версией программы (перекомпилируйте его): " + file);
+    if (h->theta_amount == 0 || h->theta_amount > MAX_ANGLE_NUM)
+        throw runtime_error("Количество углов в файле с типами должно быть от 1 до MAX_ANGLE_NUM: " + file);
+
+    // проверяем, что все массивы целиком лежат внутри файла:
+    auto check = [&](uint64_t offset, uint64_t bytes) {
+        if (offset % BINARY_ALIGN != 0 || offset + bytes > mapped.size)
+            throw runtime_error("Файл с типами повреждён: " + file);
+    };
+    uint64_t n = h->types_amount, m = h->succ_amount;
+    check(h->succ_begin, (n + 1) * sizeof(int));
+    check(h->succ, m * sizeof(TypeSuccessor));
+    check(h->start_type_by_theta, h->theta_amount * sizeof(int));
+    check(h->goal_mask_by_type, n * sizeof(uint32_t));
+    check(h->goal_theta_by_type, n * sizeof(int));
+    check(h->add_info_by_type, n * sizeof(int));
+    check(h->file_type_by_type, n * sizeof(int));
+
+    theta_amount = h->theta_amount;
+    types_amount = n;
+    info_amount = h->info_amount;
+    succ_amount = m;
+    succ_begin = mapped.at <int> (h->succ_begin);
+    succ = mapped.at <TypeSuccessor> (h->succ);
+    start_type_by_theta = mapped.at <int> (h->start_type_by_theta);
+    goal_mask_by_type = mapped.at <uint32_t> (h->goal_mask_by_type);
+    goal_theta_by_type = mapped.at <int> (h->goal_theta_by_type);
+    add_info_by_type = mapped.at <int> (h->add_info_by_type);
+    file_type_by_type = mapped.at <int> (h->file_type_by_type);
+    file_types_amount = h->file_types_amount;
+    source_size = h->source_size;
+    source_mtime = h->source_mtime;
+
+    if (types_amount <= 0 || info_amount <= 0 || file_types_amount < types_amount ||
+        succ_begin[0] != 0 || succ_begin[types_amount] != succ_amount)
+        throw runtime_error("Файл с типами повреждён: " + file);
+    // номера типов и информации используются как индексы (предшественники, быстрый CLOSED) -> проверяем их все:
+    for (int type = 0; type < types_amount; type ++)
+        if (succ_begin[type] > succ_begin[type + 1] || add_info_by_type[type] < 0 || add_info_by_type[type] >= info_amount ||
+            goal_theta_by_type[type] < -2 || goal_theta_by_type[type] >= theta_amount ||
+            file_type_by_type[type] < 0 || file_type_by_type[type] >= file_types_amount)
+            throw runtime_error("Файл с типами повреждён: " + file);
+    for (long long k = 0; k < succ_amount; k ++)
+        if (succ[k].type < 0 || succ[k].type >= types_amount || succ[k].info < 0 || succ[k].info >= info_amount)
+            throw runtime_error("Файл с типами повреждён: " + file);
+    for (int theta = 0; theta < theta_amount; theta ++)  // (-1 - под этим углом не начинается ни один примитив)
+        if (start_type_by_theta[theta] < -1 || start_type_by_theta[theta] >= types_amount)
+            throw runtime_error("Файл с типами повреждён: " + file);
+}
+
+
+uint64_t TypeInfo::checksum() {
+    /*
+    Данная функция считает контрольную сумму (FNV-1a) всего, что поиск берёт из типов: переходов, начальных типов,
+    целевых масок и углов и информации для склеивания. По ней сгенерированная таблица типов (KC_static_types.hpp)
+    проверяет, что она построена по тем же типам, что загружены.
+    */
+
+    uint64_t hash = 14695981039346656037ull;
+    auto add = [&hash](long long x) {
+        for (int b = 0; b < 8; b ++) {
+            hash ^= (x >> (8 * b)) & 0xFF;
+            hash *= 1099511628211ull;
+        }
+    };
+
+    add(theta_amount);
+    add(types_amount);
+    add(succ_amount);
+    for (int type = 0; type <= types_amount; type ++)
+        add(succ_begin[type]);
+    for (long long k = 0; k < succ_amount; k ++) {  // (стоимость перехода задаётся сдвигом, её не добавляем)
+        add(succ[k].di);
+        add(succ[k].dj);
+        add(succ[k].type);
+        add(succ[k].info);
+    }
+    for (int theta = 0; theta < theta_amount; theta ++)
+        add(start_type_by_theta[theta]);
+    for (int type = 0; type < types_amount; type ++) {
+        add(goal_mask_by_type[type]);
+        add(goal_theta_by_type[type]);
+        add(add_info_by_type[type]);
+    }
+    return hash;
+}
+
+
+void TypeInfo::save_binary(string file) {
+    /*
+    Данная функция сохраняет уже загруженные типы в скомпилированном бинарном формате в файл file.
+    */
+
+    TypesHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, TYPES_MAGIC, 8);
+    h.version = TYPES_VERSION;
+    h.long_double_size = sizeof(long double);
+    h.theta_amount = theta_amount;
+    h.types_amount = types_amount;
+    h.info_amount = info_amount;
+    h.successor_size = sizeof(TypeSuccessor);
+    h.succ_amount = succ_amount;
+    h.file_types_amount = file_types_amount;
+    h.source_size = source_size;
+    h.source_mtime = source_mtime;
+
+    // у long double в TypeSuccessor есть неиспользуемые байты выравнивания - обнуляем их, чтобы файл не зависел от мусора в памяти:
+    vector <TypeSuccessor> records(succ_amount);
+    memset((void *) records.data(), 0, succ_amount * sizeof(TypeSuccessor));
+    for (long long k = 0; k < succ_amount; k ++) {
+        records[k].di = succ[k].di;
+        records[k].dj = succ[k].dj;
+        records[k].type = succ[k].type;
+        records[k].info = succ[k].info;
+        records[k].cost = succ[k].cost;
+    }
+
+    BinaryWriter out(sizeof(h));
+    h.succ_begin = out.add_array(succ_begin, types_amount + 1);
+    h.succ = out.add_array(records.data(), succ_amount);
+    h.start_type_by_theta = out.add_array(start_type_by_theta, theta_amount);
+    h.goal_mask_by_type = out.add_array(goal_mask_by_type, types_amount);
+    h.goal_theta_by_type = out.add_array(goal_theta_by_type, types_amount);
+    h.add_info_by_type = out.add_array(add_info_by_type, types_amount);
+    h.file_type_by_type = out.add_array(file_type_by_type, types_amount);
+    out.save(file, &h, sizeof(h));
+}
+
+
+bool TypeInfo::compiled_from(string binary_file, string source_file) {
+    /*
+    Данная функция проверяет, что binary_file - скомпилированный текущей версией программы файл с типами, что он
+    скомпилирован из source_file в его нынешнем виде (совпадают размер и время изменения, как у кэшей карт) и что он
+    не повреждён (загружается без ошибок).
+    */
+
+    uint64_t size;
+    int64_t mtime;
+    MappedFile binary;
+    if (!file_stamp(source_file, size, mtime) || !file_starts_with(binary_file, TYPES_MAGIC) ||
+        !binary.open(binary_file) || binary.size < sizeof(TypesHeader))
+        return 0;
+    const TypesHeader *h = binary.at <TypesHeader> (0);
+    if (h->version != TYPES_VERSION || h->source_size != size || h->source_mtime != mtime)
+        return 0;
+
+    try {  // повреждённый файл тоже не годится (load_binary проверяет его целиком) -> тогда берётся текстовый
+        TypeInfo check;
+        check.load_binary(binary_file);
+    } catch (const runtime_error &) {
+        return 0;
+    }
+    return 1;
 }
@@ -13,17 +13,22 @@
 #include "KC_searching.hpp"
 #include "KC_structs.hpp"
 #include "KC_astar.hpp"
+#include "KC_perf.hpp"
+#include "KC_results.hpp"
+#include "KC_deadends.hpp"
+#include "KC_trajectory.hpp"
+#include "KC_server.hpp"
 #include "common.hpp"
 #include "rassert.hpp"
 
 using namespace std;
 
-MyHEAP *HEAP;  
+thread_local MyHEAP *HEAP;  
 
 
 
 
-static void load_scenes(vector <Vertex *> &starts, vector <Vertex *> &goals, string SCEN_FILE, int samples=3) {
+static void load_scenes(vector <Vertex *> &starts, vector <Vertex *> &goals, string SCEN_FILE, int theta_amount, int samples=3) {
     /*
     Данная функция должна подготовить сценарии тестирования для фиксированной карты. Каждый сценарий является
     просто парой начальной дискретного состояния и финишного дискретного состояния, между которыми искать траекторию.
@@ -32,13 +37,14 @@ static void load_scenes(vector <Vertex *> &starts, vector <Vertex *> &goals, str
     В этом файле перечислены координаты начальной и целевой клетки (они гарантированно не заняты препятствием и по логике
     должны были генерироваться случайно) -> данной функции остаётся сгенерировать угол направления для каждой из них - это
     делается случайно и равномерно.
-    Переменная samples указывает по сколько направлений генерировать для клетки (стартовой и целевой).
+    Переменная samples указывает по сколько направлений генерировать для клетки (стартовой и целевой), а theta_amount -
+    сколько всего дискретных направлений.
     */
 
     std::random_device dev;  // создаём генератор случайных чисел
     std::mt19937 rng(dev());
     rng.seed(12345);  // фиксируем его seed, чтобы при перезапуске результаты были одинаковыми
-    std::uniform_int_distribution<std::mt19937::result_type> uni_dist(1, ANGLE_NUM);  // фиксируем равномерное распределение от от 1 до ANGLE_NUM включительно
+    std::uniform_int_distribution<std::mt19937::result_type> uni_dist(1, theta_amount);  // фиксируем равномерное распределение от от 1 до theta_amount включительно
     // (подробнее: https://stackoverflow.com/questions/13445688/how-to-generate-a-random-number-in-c)
 
     ifstream scens(SCEN_FILE);
@@ -55,7 +61,7 @@ static void load_scenes(vector <Vertex *> &starts, vector <Vertex *> &goals, str
         int start_theta, goal_theta;
         for (int i = 0; i < samples; i ++) {
             start_theta = uni_dist(rng)-1;  // генерируем стартовое и финишное направления (случайно, равномерно)
-            goal_theta = uni_dist(rng)-1;  // делаем -1, чтобы угол от 0 до ANGLE_NUM-1
+            goal_theta = uni_dist(rng)-1;  // делаем -1, чтобы угол от 0 до theta_amount-1
 
             starts.push_back(new Vertex(start_i, start_j, start_theta));  // создаём вершины для поиска
             goals.push_back(new Vertex(goal_i, goal_j, goal_theta));
@@ -69,10 +75,40 @@ static void load_scenes(vector <Vertex *> &starts, vector <Vertex *> &goals, str
 
 
 
-void test_algorithm(string PRIM_FILE, string TYPES_FILE, string MAP_FILE, string SCEN_FILE, string RESULT_FILE) {
+static ResultRecord make_record(int test, Vertex *start, Vertex *goal, string algorithm, int param,
+                                ResultSearch &res, double dur, PerfCounters &perf) {
+    /*
+    Данная функция собирает в одну запись все метрики запуска алгоритма algorithm (с параметром param) на тесте номер test:
+    результат поиска res, время работы dur и значения аппаратных счётчиков perf.
+    */
+
+    ResultRecord record;
+    record.test = test;
+    record.start_i = start->i;
+    record.start_j = start->j;
+    record.start_theta = start->theta;
+    record.goal_i = goal->i;
+    record.goal_j = goal->j;
+    record.goal_theta = goal->theta;
+    record.algorithm = algorithm;
+    record.param = param;
+    record.find_path = res.find_path;
+    record.steps = res.steps;
+    record.cost = res.find_path ? (double) res.final_node->g : -1;  // стоимость пути (это g-значение)
+    record.time = dur;
+    record.stats = res.stats;
+    for (int k = 0; k < PERF_EVENTS_NUM; k ++)
+        record.perf[k] = perf.values[k];
+    return record;
+}
+
+
+void test_algorithm(string PRIM_FILE, string TYPES_FILE, string MAP_FILE, string SCEN_FILE, string RESULT_FILE,
+                    string RESULT_FORMAT = "CSV") {
     /*
     Данная функция проводит тестирования алгоритмов PRIM, COST, TYPES, PARALL_20, _100, _500 на карте
-    MAP_FILE со сценариями SCEN_FILE и сохраняет результат в RESULT_FILE.
+    MAP_FILE со сценариями SCEN_FILE и сохраняет результат в RESULT_FILE в формате RESULT_FORMAT (CSV, JSONL,
+    BIN или старый текстовый TXT - см. KC_results.hpp).
     В алгоритмах используются control set из PRIM_FILE и типы с TYPES_FILE.
     */
 
@@ -87,94 +123,117 @@ void test_algorithm(string PRIM_FILE, string TYPES_FILE, string MAP_FILE, string
     TypeInfo *type_info = new TypeInfo();
     type_info->load_types(TYPES_FILE);  // загрузили типы
     cout << "Используются типы из файла: " << TYPES_FILE << endl;
+    if (type_info->theta_amount != control_set->theta_amount)
+        throw runtime_error("Количество дискретных направлений в control set и в типах не совпадает!");
+    cout << "Количество дискретных направлений: " << control_set->theta_amount << endl;
+
+    // маска тупиковых состояний для пары (карта, control set) - кэшируется рядом с картой:
+    string prim_name = PRIM_FILE.substr(PRIM_FILE.find_last_of('/') + 1);
+    prim_name = prim_name.substr(0, prim_name.find_last_of('.'));
+    DeadEnds *dead_ends = new DeadEnds();
+    dead_ends->load_or_compute(map, control_set, MAP_FILE, MAP_FILE + "." + prim_name + ".kdead");
+    cout << "Тупиковых состояний: " << dead_ends->dead_amount << endl;
 
     vector <Vertex *> starts;
     vector <Vertex *> goals;
-    load_scenes(starts, goals, SCEN_FILE);  // загрузили сценарии
+    load_scenes(starts, goals, SCEN_FILE, control_set->theta_amount);  // загрузили сценарии
     cout << "Используются сценарии тестирования из файла: " << SCEN_FILE << endl;
     int N = starts.size();  // количество всего тестов
 
-    ofstream resfile(RESULT_FILE);  // файл для результата тестов
-    rassert(resfile.is_open() == 1, "Файла для результатов не существует!");
-    resfile << "TOTAL TESTS: " << N << endl; 
-
+    ResultWriter writer(RESULT_FILE, RESULT_FORMAT);  // сюда складываем результаты тестов (в файл их пишет фоновый поток)
 
     clock_t t0;
     double dur;
     ResultSearch res = ResultSearch(0, 0, NULL_Node);
+    PerfCounters perf;  // аппаратные счётчики (работают, только если объявлен PERF_COUNTERS и счётчики доступны)
 
+    int rejected = 0;  // сколько тестов отвергнуто проверкой связности
     for (int i = 0; i < min(N, MAX_TESTS); i ++) {  // проводим не более MAX_TESTS тестирований
 
-        // информация о тесте:
-        resfile << "=== Test: " << i << " ===" << endl;  
-        resfile << "start: " << starts[i]->i << " " << starts[i]->j << " " << starts[i]->theta << endl;
-        resfile << "goal: " << goals[i]->i << " " << goals[i]->j << " " << goals[i]->theta << endl;
-        resfile << "---" << endl;
+        // === проверка связности ===
+        // если старт и финиш в разных компонентах связности карты, то пути точно нет -> не запускаем алгоритмы
+        // (каждый из них раскрыл бы всю доступную часть графа), а сразу записываем для них отрицательный результат
+        t0 = clock();
+        bool reachable = may_reach(map, starts[i], goals[i], 3.0);  // R = 3 - как по умолчанию в StateLatticeParams и TypesGraphParams
+        dur = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        if (!reachable) {
+            rejected += 1;
+            res = ResultSearch(0, 0, NULL_Node);
+            vector <pair <string, int>> algorithms = {{"PRIM", 0}, {"COST", 0}, {"TYPES", 0}, {"PARALL", 20}, {"PARALL", 100}, {"PARALL", 500}};
+            for (auto &alg: algorithms) {
+                ResultRecord record = make_record(i, starts[i], goals[i], alg.first, alg.second, res, dur, perf);
+                record.rejected = 1;
+                for (int k = 0; k < PERF_EVENTS_NUM; k ++)
+                    record.perf[k] = -1;  // счётчики не запускались
+                writer.write(record);
+            }
+            continue;
+        }
 
         // === алгоритм PRIM ===
         StateLatticeParams *prims = new StateLatticeParams(starts[i], goals[i], map,
-                                                           control_set, true, "PRIM");
+                                                           control_set, true, "PRIM", 3.0, 1, dead_ends);
+        perf.start();
         t0 = clock();
         res = AstarSearch(prims);
         dur = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        perf.stop();
 
-        res.print(resfile, "PRIM");
-        resfile << "time PRIMS: " << dur << endl;  // время работы алгоритма
+        writer.write(make_record(i, starts[i], goals[i], "PRIM", 0, res, dur, perf));
         delete prims->ast;  // очистка памяти
         delete prims;
         if (res.find_path == 1) HEAP->delete_SearchNode(res.final_node);  // удаляем последнюю вершину (она уже не в OPEN и не в CLOSED -> ее нужно отдельно удалять)
-        resfile << "---" << endl;
 
         
         // === алгоритм COST ===
         prims = new StateLatticeParams(starts[i], goals[i], map,
-                                       control_set, true, "COST");
+                                       control_set, true, "COST", 3.0, 1, dead_ends);
+        perf.start();
         t0 = clock();
         res = AstarSearch(prims);
         dur = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        perf.stop();
 
-        res.print(resfile, "COST");
-        resfile << "time COST: " << dur << endl;
+        writer.write(make_record(i, starts[i], goals[i], "COST", 0, res, dur, perf));
         delete prims->ast;  // очистка памяти
         delete prims;
         if (res.find_path == 1) HEAP->delete_SearchNode(res.final_node); 
-        resfile << "---" << endl;
 
         // === улучшение (TYPES) ===
         TypesGraphParams *types = new TypesGraphParams(starts[i], goals[i], map,
                                                        type_info, true);
+        perf.start();
         t0 = clock();
         res = AstarSearch(types);
         dur = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        perf.stop();
 
-        res.print(resfile, "TYPES");
-        resfile << "time TYPES: " << dur << endl;
+        writer.write(make_record(i, starts[i], goals[i], "TYPES", 0, res, dur, perf));
         delete types->ast;  // очистка памяти
         delete types;
         if (res.find_path == 1) HEAP->delete_SearchNode(res.final_node); 
-        resfile << "---" << endl;
         
         
         // === PARALL ===
         vector <int> Ts = {20, 100, 500};
         for (int T: Ts) {
             prims = new StateLatticeParams(starts[i], goals[i], map,
-                                           control_set, true, "COST");
+                                           control_set, true, "COST", 3.0, 1, dead_ends);
             types = new TypesGraphParams(starts[i], goals[i], map,
                                          type_info, true);
 
+            perf.start();
             t0 = clock();
             res = PARALL(prims, types, T);
             dur = (double)(clock() - t0) / CLOCKS_PER_SEC;
+            perf.stop();
 
-            res.print(resfile, "PARALL");
-            resfile << "time PARALL " << T << ": " << dur << endl;
+            writer.write(make_record(i, starts[i], goals[i], "PARALL", T, res, dur, perf));
             delete types->ast;
             delete types;
             delete prims->ast;
             delete prims;
             if (res.find_path == 1) HEAP->delete_SearchNode(res.final_node); 
-            resfile << "---" << endl;
         }
     }
 
@@ -184,10 +243,12 @@ void test_algorithm(string PRIM_FILE, string TYPES_FILE, string MAP_FILE, string
         delete goals[i];
     }
 
-    resfile.close();
+    writer.close();  // дожидаемся, пока все результаты будут записаны
+    cout << "Отвергнуто проверкой связности тестов: " << rejected << " из " << min(N, MAX_TESTS) << endl;
     delete map;
     delete control_set;
     delete type_info;
+    delete dead_ends;
 
     cout << "Тестирование карты " << MAP_FILE << " завершено!!!"  << endl;
 }
@@ -207,7 +268,8 @@ void make_path(Vertex *start, Vertex *finish,
     дискретных состояний, примитивами между которыми образуется траектория; в случае поиска на графе типов
     это будет последовательность целевых ячеек в пути - в файле KC_astar.hpp уже обсуждалось, что для
     восстановления пути на графе типов достаточно помнить только целевые ячейки на пути), будет сохранён
-    в файл RES_FILE.
+    в файл RES_FILE. Если при поиске на графе типов указан и PRIM_FILE, то по цепочке целевых ячеек
+    восстанавливается и траектория из примитивов (см. KC_trajectory.hpp).
     */
 
     ofstream resfile(RES_FILE);
@@ -237,6 +299,12 @@ void make_path(Vertex *start, Vertex *finish,
                 resfile << node->vertex->i << " " << node->vertex->j << " " << node->vertex->theta << endl;
                 node = node->parent; 
             }
+
+            PrimitiveIndex index(control_set);  // по состояниям находим примитивы и выводим саму траекторию
+            ResultTrajectory traj = lattice_trajectory(prim, res.final_node, &index);
+            resfile << "Точки траектории i,j, начиная со старта:" << endl;
+            TrajectoryWriter writer(resfile);
+            writer.write(traj);
         }
 
         if (res.find_path == 1) HEAP->delete_SearchNode(res.final_node); 
@@ -259,9 +327,29 @@ void make_path(Vertex *start, Vertex *finish,
             ptrSearchNode node = res.final_node;
             while (!(node == NULL_Node)) {  // так как мы специально хранили в качестве parent только целевые вершины, то просто проходимся по ним
                 rassert(types_info->goal_theta_by_type[node->vertex->type] != -1, "Все ячейки, указанные в parent на пути должны быть целевыми!");
-                resfile << node->vertex->i << " " << node->vertex->j << " " << node->vertex->type << endl;
+                resfile << node->vertex->i << " " << node->vertex->j << " " << types_info->file_type_by_type[node->vertex->type] << endl;  // (тип - в номерах файла)
                 node = node->parent; 
             }
+
+            if (PRIM_FILE != "") {  // если указан control set, то по цепочке восстанавливаем и саму траекторию
+                ControlSet *control_set = new ControlSet();
+                control_set->load_primitives(PRIM_FILE);
+                PrimitiveIndex *index = new PrimitiveIndex(control_set);
+                ResultTrajectory traj = reconstruct_trajectory(types, res.final_node, index);
+                if (traj.found == 0)
+                    resfile << "Траекторию из примитивов восстановить не удалось!" << endl;
+                else {
+                    resfile << "Траектория восстановлена, стоимость коллизионных следов: " << traj.cost << endl;
+                    resfile << "Последовательность дискретных состояний i,j,theta, начиная со старта:" << endl;
+                    for (Vertex &v: traj.states)
+                        resfile << v.i << " " << v.j << " " << v.theta << endl;
+                    resfile << "Точки траектории i,j, начиная со старта:" << endl;
+                    TrajectoryWriter writer(resfile);
+                    writer.write(traj);
+                }
+                delete index;
+                delete control_set;
+            }
         }
 
         if (res.find_path == 1) HEAP->delete_SearchNode(res.final_node); 
@@ -281,9 +369,34 @@ void make_path(Vertex *start, Vertex *finish,
 
 
 
+static string data_file(string name, bool (*compiled_from)(string, string)) {
+    /*
+    Данная функция возвращает путь к файлу name из data/: если есть скомпилированный бинарный файл
+    (make compiled_data) и он скомпилирован из текстового в его нынешнем виде (проверяет compiled_from), то берётся
+    он (он загружается намного быстрее), иначе - текстовый.
+    */
+
+    if (compiled_from(name + ".bin", name + ".txt"))
+        return name + ".bin";
+    return name + ".txt";
+}
+
+
+
+
 //=====================================
 
-int main() {
+int main(int argc, char **argv) {
+
+    // Режим сервера запросов (см. KC_server.hpp): ./test_astar serve <файл реестра> [путь к Unix-сокету|-] [количество потоков] [размер сохранённых деревьев]
+    if (argc > 1 && string(argv[1]) == "serve") {
+        if (argc < 3) {
+            cout << "Использование: " << argv[0] << " serve <файл реестра> [путь к Unix-сокету|-] [количество потоков] [размер сохранённых деревьев]" << endl;
+            return 1;
+        }
+        return run_server(argv[2], argc > 3 ? argv[3] : "-", argc > 4 ? atoi(argv[4]) : 0,
+                          argc > 5 ? atoll(argv[5]) : MAX_KEPT_NODES);
+    }
 
     /*
 
@@ -360,9 +473,9 @@ int main() {
 
                 string map = pref_map + maps[i] + ".map";
                 string scen = pref_map + maps[i] + ".map.scen";
-                string control_set = pref_prim + cs[j] + ".txt";
-                string type = pref_prim + types[j] + ".txt";
-                string res = pref_res + maps[i] + "_" + cs[j] + ".txt";
+                string control_set = data_file(pref_prim + cs[j], ControlSet::compiled_from);
+                string type = data_file(pref_prim + types[j], TypeInfo::compiled_from);
+                string res = pref_res + maps[i] + "_" + cs[j] + ".csv";
                 //cout << control_set << " " << type << " " << map << " " << scen << " " << res << endl;
                 test_algorithm(control_set, type, map, scen, res);  // запускаем тестирование
 
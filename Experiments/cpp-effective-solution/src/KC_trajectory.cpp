@@ -0,0 +1,187 @@
+#include <vector>
+#include <algorithm>
+
+#include "KC_trajectory.hpp"
+#include "rassert.hpp"
+
+using namespace std;
+
+
+
+
+PrimitiveIndex::PrimitiveIndex(ControlSet *control_set) {
+    /*
+    Конструктор: раскладывает все примитивы control set по их четвёркам (начальный угол, di, dj, конечный угол).
+    */
+
+    this->control_set = control_set;
+    max_span = 0;
+    for (int theta = 0; theta < control_set->theta_amount; theta ++)
+        for (Primitive *prim: control_set->get_prims_by_heading(theta)) {
+            index[key(prim->start_theta, prim->goal.i, prim->goal.j, prim->goal.theta)].push_back(prim);
+            max_span = max(max_span, prim->collision_size);
+        }
+}
+
+
+uint64_t PrimitiveIndex::key(int start_theta, int di, int dj, int goal_theta) {
+    /*
+    Упаковываем четвёрку в одно число: углы меньше MAX_ANGLE_NUM, а сдвиги - по 24 бита со смещением (чтобы были неотрицательны).
+    */
+
+    return ((uint64_t)start_theta << 56) | ((uint64_t)goal_theta << 48) |
+           ((uint64_t)(uint32_t)(di + (1 << 23)) << 24) | (uint64_t)(uint32_t)(dj + (1 << 23));
+}
+
+
+const vector <Primitive*> *PrimitiveIndex::find(int start_theta, int di, int dj, int goal_theta) {
+    auto it = index.find(key(start_theta, di, dj, goal_theta));
+    return it == index.end() ? NULL : &it->second;
+}
+
+
+
+
+ResultTrajectory reconstruct_trajectory(TypesGraphParams *p, ptrSearchNode final_node, PrimitiveIndex *index) {
+    /*
+    Данная функция восстанавливает траекторию по пути на графе типов, который заканчивается в вершине поиска
+    final_node (поиск с параметрами p; дерево поиска к этому моменту ещё не должно быть удалено).
+    Начальный угол траектории - p->start->theta, конечный - любой, под которым в последней ячейке кончается примитив и
+    который подходит к цели (p->goal_window).
+    */
+
+    rassert(index->control_set->theta_amount == p->type_info->theta_amount, "Control set и типы должны иметь одинаковое количество углов!");
+    ResultTrajectory res;
+    res.found = 0;
+    res.cost = -1;
+
+    // выписываем цепочку целевых ячеек (i, j, тип) от цели к старту:
+    vector <Vertex> chain;
+    ptrSearchNode node = final_node;
+    while (!(node == NULL_Node)) {
+        chain.push_back(Vertex(node->vertex->i, node->vertex->j, node->vertex->type, node->vertex->info));
+        if (node->parent == NULL_Node && node->vertex->i == p->start->i && node->vertex->j == p->start->j)
+            chain.pop_back();  // стартовая ячейка: вместо неё будет само стартовое состояние (угол в ней известен точно)
+        node = node->parent;
+    }
+    chain.push_back(*p->start);
+    reverse(chain.begin(), chain.end());
+
+    int n = chain.size(), theta_amount = p->type_info->theta_amount;
+    const long double INF = 1e30;  // (при -ffast-math настоящая бесконечность ненадёжна)
+    vector <long double> best(n * theta_amount, INF);  // best[k * theta_amount + theta] - стоимость доезда до k-ой ячейки под углом theta
+    vector <int> from(n * theta_amount, -1);  // откуда (тоже номер пары) пришли в эту пару
+    vector <Primitive*> by(n * theta_amount, NULL);  // каким примитивом
+    best[p->start->theta] = 0;
+
+    Vertex dummy(0, 0, 0);
+    StateLatticeParams params(&dummy, &dummy, p->task_map, index->control_set, false, "COST");  // нужен только ради check_prim
+
+    for (int k = 0; k < n - 1; k ++)  // цепочка идёт по порядку пути -> пары можно обрабатывать по возрастанию k
+        for (int theta = 0; theta < theta_amount; theta ++) {
+            int cur = k * theta_amount + theta;
+            if (best[cur] >= INF)
+                continue;
+            for (int m = k + 1; m < n && m <= k + index->max_span; m ++) {
+                uint32_t mask = p->type_info->goal_mask_by_type[chain[m].type];
+                for (int goal_theta = 0; goal_theta < theta_amount; goal_theta ++) {
+                    if (((mask >> goal_theta) & 1) == 0)
+                        continue;
+                    const vector <Primitive*> *prims = index->find(theta, chain[m].i - chain[k].i, chain[m].j - chain[k].j, goal_theta);
+                    if (prims == NULL)
+                        continue;
+                    int next = m * theta_amount + goal_theta;
+                    for (Primitive *prim: *prims)
+                        if (best[cur] + prim->collision_cost < best[next] && params.check_prim(chain[k].i, chain[k].j, prim)) {
+                            best[next] = best[cur] + prim->collision_cost;
+                            from[next] = cur;
+                            by[next] = prim;
+                        }
+                }
+            }
+        }
+    delete params.ast;
+
+    int last = -1;  // лучшая пара в последней ячейке цепочки, угол которой подходит к цели
+    for (int theta = 0; theta < theta_amount; theta ++) {
+        int pair = (n - 1) * theta_amount + theta;
+        if (((p->goal_window >> theta) & 1) && best[pair] < INF && (last == -1 || best[pair] < best[last]))
+            last = pair;
+    }
+    if (last == -1)
+        return res;
+
+    res.found = 1;
+    res.cost = best[last];
+    for (int pair = last; pair != -1; pair = from[pair]) {
+        int k = pair / theta_amount;
+        res.states.push_back(Vertex(chain[k].i, chain[k].j, pair % theta_amount));
+        if (by[pair] != NULL)
+            res.prims.push_back(by[pair]);
+    }
+    reverse(res.states.begin(), res.states.end());
+    reverse(res.prims.begin(), res.prims.end());
+    return res;
+}
+
+
+ResultTrajectory lattice_trajectory(StateLatticeParams *p, ptrSearchNode final_node, PrimitiveIndex *index) {
+    /*
+    Данная функция находит примитивы пути на state lattice, который заканчивается в вершине поиска final_node (поиск
+    с параметрами p). Между соседними состояниями берётся самый дешёвый (p->edge_cost) допустимый примитив - именно
+    по такому ребру поиск и пришёл в состояние.
+    */
+
+    ResultTrajectory res;
+    res.found = 1;
+    res.cost = 0;
+    for (ptrSearchNode node = final_node; !(node == NULL_Node); node = node->parent)
+        res.states.push_back(Vertex(node->vertex->i, node->vertex->j, node->vertex->theta));
+    reverse(res.states.begin(), res.states.end());
+
+    for (size_t k = 0; k + 1 < res.states.size(); k ++) {
+        Vertex &from = res.states[k], &to = res.states[k+1];
+        const vector <Primitive*> *prims = index->find(from.theta, to.i - from.i, to.j - from.j, to.theta);
+        Primitive *best = NULL;
+        if (prims != NULL)
+            for (Primitive *prim: *prims)
+                if ((best == NULL || p->edge_cost(prim) < p->edge_cost(best)) && p->check_prim(from.i, from.j, prim))
+                    best = prim;
+        rassert(best != NULL, "Между соседними состояниями пути на state lattice должен быть допустимый примитив!");
+        res.prims.push_back(best);
+        res.cost += p->edge_cost(best);
+    }
+    return res;
+}
+
+
+
+
+TrajectoryWriter::TrajectoryWriter(ostream &out): out(out) {
+    points = 0;
+}
+
+
+void TrajectoryWriter::add(const Vertex &from, Primitive *prim) {
+    /*
+    Данная функция выводит точки траектории примитива prim, начинающегося в состоянии from. Первая точка примитива
+    совпадает с последней точкой предыдущего, поэтому (кроме самого первого примитива) она пропускается.
+    */
+
+    for (int k = (points == 0 ? 0 : 1); k < prim->traj_size; k ++) {
+        float i = from.i + prim->coll_sign_i * (float) prim->traj_in_i[k];
+        float j = from.j + prim->coll_sign_j * (float) prim->traj_in_j[k];
+        out << i << " " << j << "\n";
+        points ++;
+    }
+}
+
+
+void TrajectoryWriter::write(ResultTrajectory &trajectory) {
+    /*
+    Данная функция выводит всю траекторию trajectory (примитивы по порядку от старта).
+    */
+
+    for (size_t k = 0; k < trajectory.prims.size(); k ++)
+        add(trajectory.states[k], trajectory.prims[k]);
+}